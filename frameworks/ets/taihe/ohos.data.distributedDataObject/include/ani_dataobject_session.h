@@ -50,6 +50,8 @@ public:
 
     ::ohos::data::distributedDataObject::SaveSuccessResponse Save(const std::string &deviceId, int32_t version);
     ::ohos::data::distributedDataObject::RevokeSaveSuccessResponse RevokeSave();
+    void SetSyncPolicy(OHOS::ObjectStore::SyncPolicy policy, uint32_t window);
+    void Commit();
 
     bool AddWatch(OHOS::ObjectStore::DistributedObjectStore *objectStore,
         const std::string &type, VarCallbackType taiheCallback);
@@ -66,13 +68,11 @@ public:
     NativeObjectValueType GetValueFromStore(const char *key);
     NativeObjectValueType GetAssetValueFromStore(const char *key);
     NativeObjectValueType GetAssetsValueFromStore(const char *key, size_t size);
-    void RemoveTypePrefixForAsset(OHOS::CommonType::AssetValue &asset);
 
 private:
-    NativeObjectValueType HandleStringType(const char* key);
-    NativeObjectValueType HandleDoubleType(const char* key);
-    NativeObjectValueType HandleBooleanType(const char* key);
-    NativeObjectValueType HandleComplexType(const char* key);
+    static bool AppendData(const std::string &key, const NativeObjectValueType &objValue,
+        std::map<std::string, OHOS::ObjectStore::FieldValue> &values);
+    uint32_t PutBatch(const std::map<std::string, OHOS::ObjectStore::FieldValue> &values);
 
 private:
     std::shared_mutex watchMutex_{};
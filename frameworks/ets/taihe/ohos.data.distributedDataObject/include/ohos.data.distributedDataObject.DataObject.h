@@ -66,6 +66,8 @@ public:
 
     ::ohos::data::distributedDataObject::SaveSuccessResponse SaveSync(::taihe::string_view deviceId);
     ::ohos::data::distributedDataObject::RevokeSaveSuccessResponse RevokeSaveSync();
+    void SetSyncPolicy(::ohos::data::distributedDataObject::SyncPolicy policy, ::taihe::optional_view<int32_t> window);
+    void CommitSync();
     bool GetFileAttribute(const std::string &pathName, size_t &size, std::string &ctime, std::string &mtime);
     OHOS::CommonType::AssetValue GetDefaultAsset(OHOS::CommonType::AssetValue initValue, const std::string &uri);
     void SetAssetSync(::taihe::string_view assetKey, ::taihe::string_view uri);
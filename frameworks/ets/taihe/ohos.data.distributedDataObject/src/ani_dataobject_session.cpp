@@ -143,6 +143,38 @@ void AniDataobjectSession::DeleteWatch(const std::string &type, VarCallbackType
     return { ::taihe::string(sessionId_) };
 }
 
+void AniDataobjectSession::SetSyncPolicy(OHOS::ObjectStore::SyncPolicy policy, uint32_t window)
+{
+    if (distributedObj_ == nullptr) {
+        auto err = std::make_shared<InnerError>();
+        AniErrorUtils::ThrowError(err->GetCode(), "object is null");
+        return;
+    }
+    uint32_t status = distributedObj_->SetSyncPolicy(policy, window);
+    if (status == ERR_INVALID_ARGS) {
+        AniErrorUtils::ThrowError(AniErrorUtils::AniError_ParameterCheck,
+            "The window must be between 1 and 60000 when the policy is WINDOWED.");
+    } else if (status != SUCCESS) {
+        auto err = std::make_shared<InnerError>();
+        AniErrorUtils::ThrowError(err->GetCode(), "operation failed");
+    }
+}
+
+void AniDataobjectSession::Commit()
+{
+    LOG_INFO("Commit, called");
+    if (distributedObj_ == nullptr) {
+        auto err = std::make_shared<InnerError>();
+        AniErrorUtils::ThrowError(err->GetCode(), "object is null");
+        return;
+    }
+    uint32_t status = distributedObj_->Commit();
+    if (status != SUCCESS) {
+        auto err = std::make_shared<InnerError>();
+        AniErrorUtils::ThrowError(err->GetCode(), "operation failed");
+    }
+}
+
 uint32_t AniDataobjectSession::BindAssetStore(const std::string &key, OHOS::ObjectStore::AssetBindInfo &nativeBindInfo)
 {
     LOG_INFO("BindAssetStore, called");
@@ -216,18 +248,44 @@ bool AniDataobjectSession::SyncAssetToStore(const std::string &key, const OHOS::
         LOG_ERROR("distributedObj_ nullptr");
         return false;
     }
-    distributedObj_->PutString(key + ASSET_KEY_SEPARATOR + "id", std::string(STRING_TYPE) + asset.id);
-    distributedObj_->PutString(key + ASSET_KEY_SEPARATOR + "name", std::string(STRING_TYPE) + asset.name);
-    distributedObj_->PutString(key + ASSET_KEY_SEPARATOR + "uri", std::string(STRING_TYPE) + asset.uri);
-    distributedObj_->PutString(key + ASSET_KEY_SEPARATOR + "createTime", std::string(STRING_TYPE) + asset.createTime);
-    distributedObj_->PutString(key + ASSET_KEY_SEPARATOR + "modifyTime", std::string(STRING_TYPE) + asset.modifyTime);
-    distributedObj_->PutString(key + ASSET_KEY_SEPARATOR + "size", std::string(STRING_TYPE) + asset.size);
-    distributedObj_->PutString(key + ASSET_KEY_SEPARATOR + "hash", std::string(STRING_TYPE) + asset.hash);
-    distributedObj_->PutString(key + ASSET_KEY_SEPARATOR + "path", std::string(STRING_TYPE) + asset.path);
-    distributedObj_->PutDouble(key + ASSET_KEY_SEPARATOR + "status", asset.status);
+    return distributedObj_->PutAsset(key, asset) == SUCCESS;
+}
+
+bool AniDataobjectSession::AppendData(
+    const std::string &key, const NativeObjectValueType &objValue, std::map<std::string, FieldValue> &values)
+{
+    if (auto pvalBool = std::get_if<bool>(&objValue)) {
+        values.insert_or_assign(key, *pvalBool);
+    } else if (auto pvalDouble = std::get_if<double>(&objValue)) {
+        values.insert_or_assign(key, *pvalDouble);
+    } else if (auto pvalStr = std::get_if<std::string>(&objValue)) {
+        values.insert_or_assign(key, *pvalStr);
+    } else if (auto pvalArray = std::get_if<std::vector<uint8_t>>(&objValue)) {
+        values.insert_or_assign(key, *pvalArray);
+    } else {
+        return std::holds_alternative<std::monostate>(objValue);
+    }
     return true;
 }
 
+uint32_t AniDataobjectSession::PutBatch(const std::map<std::string, FieldValue> &values)
+{
+    // A record larger than one transaction is written in as few of them as possible.
+    std::map<std::string, FieldValue> batch;
+    for (const auto &[key, value] : values) {
+        batch.emplace(key, value);
+        if (batch.size() < DistributedObject::MAX_BATCH_SIZE) {
+            continue;
+        }
+        uint32_t status = distributedObj_->PutBatch(batch);
+        if (status != SUCCESS) {
+            return status;
+        }
+        batch.clear();
+    }
+    return batch.empty() ? SUCCESS : distributedObj_->PutBatch(batch);
+}
+
 bool AniDataobjectSession::SyncAssetPropertyToStore(
     const std::string &key, const std::string &property, uint32_t value)
 {
@@ -274,60 +332,22 @@ uint32_t AniDataobjectSession::FlushCachedData(const std::map<std::string, Nativ
         AniErrorUtils::ThrowError(err->GetCode(), "object is null");
         return ERR_NULL_OBJECT;
     }
+    std::map<std::string, FieldValue> values;
     for (const auto &[key, value] : dataMap) {
-        SyncDataToStore(key, value, true);
+        if (!AppendData(key, value, values)) {
+            SyncDataToStore(key, value, true);
+        }
+    }
+    if (values.empty()) {
+        return 0;
+    }
+    uint32_t status = PutBatch(values);
+    if (status != SUCCESS) {
+        LOG_ERROR("FlushCachedData PutBatch failed, status:%{public}d, size:%{public}zu", status, values.size());
     }
     return 0;
 }
 
-NativeObjectValueType AniDataobjectSession::HandleStringType(const char* key)
-{
-    NativeObjectValueType resultValueType;
-    std::string result;
-    uint32_t ret = distributedObj_->GetString(key, result);
-    if (ret == SUCCESS) {
-        resultValueType = result;
-        LOG_INFO("GetValueFromStore, result %{public}s", result.c_str());
-    }
-    return resultValueType;
-}
-
-NativeObjectValueType AniDataobjectSession::HandleDoubleType(const char* key)
-{
-    NativeObjectValueType resultValueType;
-    double result = 0;
-    uint32_t ret = distributedObj_->GetDouble(key, result);
-    if (ret == SUCCESS) {
-        resultValueType = result;
-        LOG_INFO("GetValueFromStore, result %{public}f", result);
-    }
-    return resultValueType;
-}
-
-NativeObjectValueType AniDataobjectSession::HandleBooleanType(const char* key)
-{
-    NativeObjectValueType resultValueType;
-    bool result;
-    uint32_t ret = distributedObj_->GetBoolean(key, result);
-    if (ret == SUCCESS) {
-        resultValueType = result;
-        LOG_INFO("GetValueFromStore, result %{public}d", result);
-    }
-    return resultValueType;
-}
-
-NativeObjectValueType AniDataobjectSession::HandleComplexType(const char* key)
-{
-    NativeObjectValueType resultValueType;
-    std::vector<uint8_t> result;
-    uint32_t ret = distributedObj_->GetComplex(key, result);
-    if (ret == SUCCESS) {
-        resultValueType = result;
-        LOG_INFO("GetValueFromStore, TYPE_COMPLEX, result %{public}zu", result.size());
-    }
-    return resultValueType;
-}
-
 NativeObjectValueType AniDataobjectSession::GetValueFromStore(const char *key)
 {
     if (distributedObj_ == nullptr) {
@@ -336,24 +356,13 @@ NativeObjectValueType AniDataobjectSession::GetValueFromStore(const char *key)
         return std::monostate();
     }
 
-    Type type = TYPE_STRING;
-    distributedObj_->GetType(std::string(key), type);
-    
-    switch (type) {
-        case TYPE_STRING:
-            return HandleStringType(key);
-        case TYPE_DOUBLE:
-            return HandleDoubleType(key);
-        case TYPE_BOOLEAN:
-            return HandleBooleanType(key);
-        case TYPE_COMPLEX:
-            return HandleComplexType(key);
-        default:
-            LOG_ERROR("error type! %{public}d", type);
-            break;
+    FieldValue value;
+    uint32_t ret = distributedObj_->Get(key, value);
+    if (ret != SUCCESS) {
+        LOG_ERROR("GetValueFromStore failed, ret:%{public}d", ret);
+        return std::monostate();
     }
-
-    return std::monostate();
+    return std::visit([](auto &item) -> NativeObjectValueType { return std::move(item); }, value);
 }
 
 NativeObjectValueType AniDataobjectSession::GetAssetValueFromStore(const char *key)
@@ -369,38 +378,10 @@ NativeObjectValueType AniDataobjectSession::GetAssetValueFromStore(const char *k
         AniErrorUtils::ThrowError(err->GetCode(), "key is null");
         return resultEmpty;
     }
-    std::string stdkey(key);
     OHOS::CommonType::AssetValue assetResult;
-    if (distributedObj_->GetString(stdkey + ASSET_KEY_SEPARATOR + "id", assetResult.id) != SUCCESS) {
-        return resultEmpty;
-    }
-    if (distributedObj_->GetString(stdkey + ASSET_KEY_SEPARATOR + "name", assetResult.name) != SUCCESS) {
-        return resultEmpty;
-    }
-    if (distributedObj_->GetString(stdkey + ASSET_KEY_SEPARATOR + "uri", assetResult.uri) != SUCCESS) {
-        return resultEmpty;
-    }
-    if (distributedObj_->GetString(stdkey + ASSET_KEY_SEPARATOR + "createTime", assetResult.createTime) != SUCCESS) {
-        return resultEmpty;
-    }
-    if (distributedObj_->GetString(stdkey + ASSET_KEY_SEPARATOR + "modifyTime", assetResult.modifyTime) != SUCCESS) {
-        return resultEmpty;
-    }
-    if (distributedObj_->GetString(stdkey + ASSET_KEY_SEPARATOR + "size", assetResult.size) != SUCCESS) {
-        return resultEmpty;
-    }
-    if (distributedObj_->GetString(stdkey + ASSET_KEY_SEPARATOR + "hash", assetResult.hash) != SUCCESS) {
+    if (distributedObj_->GetAsset(key, assetResult) != SUCCESS) {
         return resultEmpty;
     }
-    if (distributedObj_->GetString(stdkey + ASSET_KEY_SEPARATOR + "path", assetResult.path) != SUCCESS) {
-        return resultEmpty;
-    }
-    double status = 0;
-    if (distributedObj_->GetDouble(stdkey + ASSET_KEY_SEPARATOR + "status", status) != SUCCESS) {
-        return resultEmpty;
-    }
-    assetResult.status = static_cast<uint32_t>(status);
-    RemoveTypePrefixForAsset(assetResult);
     return assetResult;
 }
 
@@ -427,22 +408,4 @@ NativeObjectValueType AniDataobjectSession::GetAssetsValueFromStore(const char *
     }
     return assets;
 }
-
-void AniDataobjectSession::RemoveTypePrefixForAsset(OHOS::CommonType::AssetValue &asset)
-{
-    auto removePrefixIfNeeded = [](std::string &str) {
-        if (str.find(STRING_TYPE) == 0) {
-            str = str.substr(std::string(STRING_TYPE).length());
-        }
-    };
-
-    removePrefixIfNeeded(asset.id);
-    removePrefixIfNeeded(asset.name);
-    removePrefixIfNeeded(asset.uri);
-    removePrefixIfNeeded(asset.createTime);
-    removePrefixIfNeeded(asset.modifyTime);
-    removePrefixIfNeeded(asset.size);
-    removePrefixIfNeeded(asset.hash);
-    removePrefixIfNeeded(asset.path);
-}
 }
\ No newline at end of file
@@ -673,6 +673,36 @@ void DataObjectImpl::LeaveAllSessionWithCallbackSync()
     return result;
 }
 
+void DataObjectImpl::SetSyncPolicy(
+    ::ohos::data::distributedDataObject::SyncPolicy policy, ::taihe::optional_view<int32_t> window)
+{
+    LOG_INFO("SetSyncPolicy");
+    int32_t windowValue = window.has_value() ? window.value() : 0;
+    if (windowValue < 0) {
+        AniErrorUtils::ThrowError(AniErrorUtils::AniError_ParameterCheck, "The window must not be negative.");
+        return;
+    }
+    std::lock_guard<std::mutex> guard(sessionInfoMutex_);
+    if (session_ == nullptr) {
+        auto err = std::make_shared<InnerError>();
+        AniErrorUtils::ThrowError(err->GetCode(), "object is null");
+        return;
+    }
+    session_->SetSyncPolicy(static_cast<SyncPolicy>(policy.get_value()), static_cast<uint32_t>(windowValue));
+}
+
+void DataObjectImpl::CommitSync()
+{
+    LOG_INFO("CommitSync");
+    std::lock_guard<std::mutex> guard(sessionInfoMutex_);
+    if (session_ == nullptr) {
+        auto err = std::make_shared<InnerError>();
+        AniErrorUtils::ThrowError(err->GetCode(), "object is null");
+        return;
+    }
+    session_->Commit();
+}
+
 bool DataObjectImpl::GetFileAttribute(const std::string &pathName, size_t &size, std::string &ctime, std::string &mtime)
 {
     LOG_INFO("GetFileAttribute");
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ASSET_CODEC_H
+#define ASSET_CODEC_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "bytes.h"
+#include "distributed_object.h"
+#include "object_types.h"
+
+namespace OHOS::ObjectStore {
+// Encodes an asset as one record stored under RECORDS_PREFIX + assetKey + ASSET_RECORD_SUFFIX:
+// [ValueCodec::TAG_ASSET][version][varint status][varint length and bytes of each string field]
+// Strings are stored without the [STRING] prefix of the split layout. A later version may append fields,
+// readers stop after the ones they know.
+// The split layout keeps one field per member, "[STRING]" prefixed strings and a double status.
+class AssetCodec final {
+public:
+    static constexpr uint8_t VERSION = 1;
+
+    AssetCodec() = delete;
+    ~AssetCodec() = delete;
+
+    static bool IsAsset(const Bytes &data);
+    static Bytes Encode(const Asset &asset);
+    static uint32_t Decode(const Bytes &data, Asset &asset);
+    // Sub-field keys of the split layout, in the order ToFields writes them.
+    static std::vector<std::string> GetFieldKeys(const std::string &assetKey);
+    static void ToFields(const std::string &assetKey, const Asset &asset, std::map<std::string, FieldValue> &fields);
+    // Fails when a sub-field every writer stores is missing, id, hash and status are optional.
+    static bool FromFields(const std::string &assetKey, const std::map<std::string, FieldValue> &fields,
+        Asset &asset);
+    // Sub-fields every change of the file rewrites, the modify time and the size.
+    static std::vector<std::string> GetCheckKeys(const std::string &assetKey);
+    // True when the check sub-fields in fields hold the values of the record.
+    static bool MatchesFields(const std::string &assetKey, const std::map<std::string, FieldValue> &fields,
+        const Asset &record);
+
+private:
+    static bool GetString(const std::map<std::string, FieldValue> &fields, const std::string &key,
+        std::string &value);
+};
+} // namespace OHOS::ObjectStore
+#endif // ASSET_CODEC_H
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ASSET_RECORD_TRACKER_H
+#define ASSET_RECORD_TRACKER_H
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace OHOS::ObjectStore {
+// Assets of each session whose record is known to match their split sub-fields.
+// A record is trusted when it changed together with its sub-fields, as PutAsset here or on a peer writes them.
+// Sub-fields changing without their record, as an older peer or a single property put does, drop the trust.
+// GetAsset checks a record it does not trust, as one written before this process started, against its sub-fields.
+class AssetRecordTracker {
+public:
+    // Keys are stored keys, keys that are neither an asset record nor an asset sub-field are skipped.
+    void OnChanged(const std::string &sessionId, const std::vector<std::string> &keys);
+    bool IsTrusted(const std::string &sessionId, const std::string &assetKey);
+    void Clear(const std::string &sessionId);
+
+private:
+    std::mutex mutex_;
+    std::map<std::string, std::set<std::string>> trusted_;
+};
+} // namespace OHOS::ObjectStore
+#endif // ASSET_RECORD_TRACKER_H
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHANGED_KEYS_H
+#define CHANGED_KEYS_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace OHOS::ObjectStore {
+// Field keys of one change notification, classified once when the notification arrives.
+// The views point into the buffers of the notification and are only valid while it is delivered.
+// Clear() keeps the capacity, so one instance can be reused across notifications.
+class ChangedKeys {
+public:
+    void Clear();
+    void Reserve(size_t count);
+    // Adds a stored key. Keys without the field prefix are skipped, except the schema record.
+    void AddStoredKey(std::string_view storedKey);
+    void AddField(std::string_view field);
+    // Sorts out assets reported by more than one sub-field, call once after the last Add.
+    void Finish();
+    // Every added field in arrival order, including asset sub-fields and the device id.
+    const std::vector<std::string_view> &GetAll() const;
+    const std::vector<std::string_view> &GetFields() const;
+    const std::vector<std::string_view> &GetAssets() const;
+    bool HasDeviceId() const;
+    // The record written by PutRecord changed, it has no field key.
+    bool HasSchemaRecord() const;
+    bool Empty() const;
+
+private:
+    std::vector<std::string_view> all_;
+    std::vector<std::string_view> fields_;
+    std::vector<std::string_view> assets_;
+    bool hasDeviceId_ = false;
+    bool hasSchemaRecord_ = false;
+};
+} // namespace OHOS::ObjectStore
+#endif // CHANGED_KEYS_H
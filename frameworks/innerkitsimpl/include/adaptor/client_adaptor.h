@@ -16,6 +16,10 @@
 #ifndef OBJECT_CLIENT_ADAPTOR_H
 #define OBJECT_CLIENT_ADAPTOR_H
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 #include "object_service_proxy.h"
 
 namespace OHOS::ObjectStore {
@@ -23,6 +27,8 @@ class ObjectStoreDataServiceProxy;
 class ClientAdaptor {
 public:
     static sptr<OHOS::DistributedObject::IObjectService> GetObjectService();
+    // Feature interface lookups made so far, every other GetObjectService call is served from the cache.
+    static uint64_t GetLookupCount();
     static uint32_t RegisterClientDeathListener(const std::string &appId, sptr<IRemoteObject> remoteObject);
 private:
     class ServiceDeathRecipient : public IRemoteObject::DeathRecipient {
@@ -38,6 +44,11 @@ private:
     static std::shared_ptr<ObjectStoreDataServiceProxy> distributedDataMgr_;
     static std::shared_ptr<ObjectStoreDataServiceProxy> GetDistributedDataManager();
     static std::mutex mutex_;
+    // The looked up object service, read without mutex_ and dropped when the data service dies.
+    static std::shared_ptr<sptr<OHOS::DistributedObject::IObjectService>> objectService_;
+    // Counts the deaths of the data service, a lookup that overlapped one is not cached. Guarded by mutex_.
+    static uint64_t serviceGeneration_;
+    static std::atomic<uint64_t> lookupCount_;
 };
 
 class ObjectStoreDataServiceProxy  : public IRemoteProxy<OHOS::DistributedObject::IKvStoreDataService> {
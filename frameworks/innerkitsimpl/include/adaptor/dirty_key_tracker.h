@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DIRTY_KEY_TRACKER_H
+#define DIRTY_KEY_TRACKER_H
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace OHOS::ObjectStore {
+// Keys written since the last successful save of a session to a target device.
+// A device without an entry has no known baseline and needs a full snapshot.
+class DirtyKeyTracker {
+public:
+    void MarkDirty(const std::string &sessionId, const std::string &key);
+    void MarkDirty(const std::string &sessionId, const std::vector<std::string> &keys);
+    bool Take(const std::string &sessionId, const std::string &deviceId, std::set<std::string> &keys);
+    void Restore(const std::string &sessionId, const std::string &deviceId, const std::set<std::string> &keys);
+    void ResetBaseline(const std::string &sessionId, const std::string &deviceId);
+    void DropBaseline(const std::string &sessionId, const std::string &deviceId);
+    void DropBaseline(const std::string &sessionId);
+
+private:
+    std::mutex mutex_;
+    std::map<std::string, std::map<std::string, std::set<std::string>>> baselines_;
+};
+} // namespace OHOS::ObjectStore
+#endif // DIRTY_KEY_TRACKER_H
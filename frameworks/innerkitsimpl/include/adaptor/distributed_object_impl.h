@@ -31,18 +31,41 @@ public:
     uint32_t GetString(const std::string &key, std::string &value) override;
     uint32_t PutComplex(const std::string &key, const std::vector<uint8_t> &value) override;
     uint32_t GetComplex(const std::string &key, std::vector<uint8_t> &value) override;
+    uint32_t GetView(const std::string &key, ValueView &value) override;
+    uint32_t PutView(const std::string &key, const ValueView &value) override;
+    uint32_t Get(const std::string &key, FieldValue &value) override;
+    uint32_t PutBatch(const std::map<std::string, FieldValue> &values) override;
+    uint32_t GetBatch(const std::vector<std::string> &keys, std::map<std::string, FieldValue> &values) override;
+    uint32_t GetAll(std::map<std::string, FieldValue> &values) override;
     std::string &GetSessionId() override;
     uint32_t Save(const std::string &deviceId) override;
     uint32_t RevokeSave() override;
+    uint32_t SaveAsync(
+        const std::string &deviceId, uint32_t timeout, const SaveCallback &callback, SaveId &saveId) override;
+    uint32_t RevokeSaveAsync(uint32_t timeout, const SaveCallback &callback, SaveId &saveId) override;
+    bool CancelSave(SaveId saveId) override;
+    uint32_t SetSyncPolicy(SyncPolicy policy, uint32_t window) override;
+    uint32_t Commit() override;
+    uint32_t GetSyncStats(SyncStats &stats) override;
+    uint32_t GetVersion(uint64_t &version) override;
     uint32_t GetType(const std::string &key, Type &type) override;
     uint32_t BindAssetStore(const std::string &assetKey, AssetBindInfo &bindInfo) override;
+    uint32_t PutAsset(const std::string &assetKey, const Asset &asset) override;
+    uint32_t GetAsset(const std::string &assetKey, Asset &asset) override;
+    PropertyHandle GetPropertyHandle(const std::string &key) override;
+    uint32_t Put(const PropertyHandle &handle, const FieldValue &value) override;
+    uint32_t Get(const PropertyHandle &handle, FieldValue &value) override;
+    uint32_t GetView(const PropertyHandle &handle, ValueView &value) override;
+    uint32_t BindSchema(const ObjectSchema &schema) override;
+    uint32_t PutRecord(const SchemaRecord &record) override;
+    uint32_t GetRecord(SchemaRecord &record) override;
 
 private:
     uint32_t GetAssetValue(const std::string &assetKey, Asset &assetValue);
     std::string sessionId_;
     FlatObjectStore *flatObjectStore_ = nullptr;
+    PropertyHandle deviceIdHandle_;
     uint32_t PutDeviceId();
-    void RemovePrefix(Asset &assetValue);
 };
 
 #define LOG_ERROR_RETURN(condition, message, retVal)             \
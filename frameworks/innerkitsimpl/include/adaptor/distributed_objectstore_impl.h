@@ -17,6 +17,7 @@
 #define DISTRIBUTED_OBJECTSTORE_IMPL_H
 
 #include <shared_mutex>
+#include <unordered_map>
 
 #include "distributed_objectstore.h"
 namespace OHOS::ObjectStore {
@@ -34,6 +35,10 @@ public:
     uint32_t Get(const std::string &sessionId, DistributedObject **object) override;
     DistributedObject *CreateObject(const std::string &sessionId) override;
     DistributedObject *CreateObject(const std::string &sessionId, uint32_t &status) override;
+    DistributedObject *CreateObject(
+        const std::string &sessionId, StorageType storageType, uint32_t &status) override;
+    void CreateObjectAsync(const std::string &sessionId, const CreateCallback &callback) override;
+    uint32_t PrepareObject(const std::string &sessionId) override;
     uint32_t DeleteObject(const std::string &sessionId) override;
     uint32_t Watch(DistributedObject *object, std::shared_ptr<ObjectWatcher> watcher) override;
     uint32_t UnWatch(DistributedObject *object) override;
@@ -41,6 +46,7 @@ public:
     uint32_t SetProgressNotifier(std::shared_ptr<ProgressNotifier> notifier) override;
     void NotifyCachedStatus(const std::string &sessionId) override;
     void NotifyProgressStatus(const std::string &sessionId) override;
+    void SetCompressThreshold(size_t threshold) override;
 
 private:
     DistributedObject *CacheObject(const std::string &sessionId, FlatObjectStore *flatObjectStore);
@@ -48,7 +54,7 @@ private:
     FlatObjectStore *flatObjectStore_ = nullptr;
     std::map<DistributedObject *, std::shared_ptr<WatcherProxy>> watchers_;
     std::shared_mutex dataMutex_ {};
-    std::vector<DistributedObject *> objects_ {};
+    std::unordered_map<std::string, DistributedObject *> objects_ {};
     std::mutex watchersLock_;
 };
 class StatusNotifierProxy : public StatusWatcher {
@@ -80,9 +86,9 @@ public:
     WatcherProxy(const std::shared_ptr<ObjectWatcher> objectWatcher, const std::string &sessionId);
     void OnChanged(
         const std::string &sessionId, const std::vector<std::string> &changedData, bool enableTransfer) override;
+    void OnChangedKeys(const std::string &sessionId, const ChangedKeys &changedKeys, bool enableTransfer) override;
     void SetAssetChangeCallBack(const AssetChangeCallback &assetChangeCallback);
 private:
-    bool FindChangedAssetKey(const std::string &changedKey, std::string &assetKey);
     std::shared_ptr<ObjectWatcher> objectWatcher_;
     AssetChangeCallback assetChangeCallback_;
 };
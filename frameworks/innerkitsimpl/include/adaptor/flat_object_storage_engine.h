@@ -16,10 +16,20 @@
 #ifndef FLAT_OBJECT_STORAGE_ENGINE_H
 #define FLAT_OBJECT_STORAGE_ENGINE_H
 
+#include <set>
+#include <shared_mutex>
+
+#include "executor_pool.h"
+#include "key_index.h"
 #include "object_storage_engine.h"
+#include "objectstore_errors.h"
+#include "sync_delta_tracker.h"
+#include "sync_scheduler.h"
+#include "versioned_items.h"
 
 namespace OHOS::ObjectStore {
-class FlatObjectStorageEngine : public ObjectStorageEngine {
+class FlatObjectStorageEngine : public ObjectStorageEngine,
+                                public std::enable_shared_from_this<FlatObjectStorageEngine> {
 public:
     FlatObjectStorageEngine() = default;
     ~FlatObjectStorageEngine() override;
@@ -32,29 +42,143 @@ public:
     uint32_t UpdateItems(const std::string &key, const std::map<std::string, std::vector<uint8_t>> &data) override;
     uint32_t GetItem(const std::string &key, const std::string &itemKey, Value &value) override;
     uint32_t GetItems(const std::string &key, std::map<std::string, std::vector<uint8_t>> &data) override;
+    uint32_t ForEachItem(const std::string &key, const ItemVisitor &visitor) override;
     uint32_t RegisterObserver(const std::string &key, std::shared_ptr<TableWatcher> watcher) override;
     uint32_t UnRegisterObserver(const std::string &key) override;
     uint32_t SetStatusNotifier(std::shared_ptr<StatusWatcher> watcher) override;
     uint32_t SetProgressNotifier(std::shared_ptr<ProgressWatcher> watcher) override;
+    using SyncCallback = std::function<void(const std::map<std::string, DistributedDB::DBStatus> &)>;
+    // SYNC_MODE_PUSH_PULL also pushes what the devices have not acknowledged yet, a pull when there is none.
     uint32_t SyncAllData(const std::string &sessionId, const std::vector<std::string> &deviceIds,
-        const std::function<void(const std::map<std::string, DistributedDB::DBStatus> &)> &onComplete);
+        const SyncCallback &onComplete, DistributedDB::SyncMode mode = DistributedDB::SyncMode::SYNC_MODE_PULL_ONLY);
     void OnComplete(const std::string &key, const std::map<std::string, DistributedDB::DBStatus> &devices,
         std::shared_ptr<StatusWatcher> statusWatcher);
-    bool isOpened_ = false;
-    void NotifyStatus(const std::string &sessionId, const std::string &deviceId, const std::string &status);
-    void NotifyChange(const std::string &sessionId, const std::map<std::string, std::vector<uint8_t>> &changedData);
-    bool NotifyProgress(const std::string &sessionId, int32_t progress);
+    void NotifyStatus(const std::string &sessionId, const std::string &deviceId, const std::string &status) override;
+    void NotifyChange(
+        const std::string &sessionId, const std::map<std::string, std::vector<uint8_t>> &changedData) override;
+    bool NotifyProgress(const std::string &sessionId, int32_t progress) override;
+    uint32_t Flush(const std::string &key) override;
+    void CreateTableAsync(const std::string &key, const std::function<void(uint32_t status)> &callback) override;
+    uint32_t PrepareTable(const std::string &key) override;
+    uint32_t FilterExistingItems(const std::string &key, std::map<std::string, std::vector<uint8_t>> &data) override;
+    uint32_t SetSyncPolicy(const std::string &key, SyncPolicy policy, uint32_t window) override;
+    uint32_t Commit(const std::string &key) override;
+    uint32_t GetSyncStats(const std::string &key, SyncStats &stats) override;
+    uint32_t GetVersion(const std::string &key, uint64_t &version) override;
+    void SetDataChangeListener(DataChangeListener listener) override;
 
 private:
+    // Puts of one session are combined here and written with a single PutBatch.
+    struct WriteBuffer {
+        std::map<std::string, Value> entries;
+        size_t bytes = 0;
+        Executor::TaskId flushTask = Executor::INVALID_TASK_ID;
+    };
+    struct Session;
+    // Reports every key written by a remote device, independent of the TableWatcher set by the app.
+    class DataChangeObserver : public DistributedDB::KvStoreObserver {
+    public:
+        DataChangeObserver(const std::string &sessionId, std::weak_ptr<FlatObjectStorageEngine> engine,
+            std::weak_ptr<Session> session);
+        void OnChange(const DistributedDB::KvStoreChangedData &data) override;
+
+    private:
+        void PublishLocked(Session &session, const std::vector<std::string> &upserted,
+            const std::vector<std::string> &deleted);
+
+        std::string sessionId_;
+        std::weak_ptr<FlatObjectStorageEngine> engine_;
+        std::weak_ptr<Session> session_;
+    };
+    // Everything owned by one table, guarded by its own mutex so that sessions do not block each other.
+    struct Session {
+        std::mutex mutex;
+        DistributedDB::KvStoreNbDelegate *delegate = nullptr;
+        std::shared_ptr<TableWatcher> observer;
+        std::shared_ptr<DataChangeObserver> changeObserver;
+        WriteBuffer buffer;
+        // A failed flush no caller was told of, returned by the next write or Flush instead of running it.
+        uint32_t flushError = SUCCESS;
+        // SYNC_AUTO leaves pushing to DistributedDB, the others push from syncTask or Commit.
+        SyncPolicy syncPolicy = SYNC_AUTO;
+        uint32_t syncWindow = 0;
+        Executor::TaskId syncTask = Executor::INVALID_TASK_ID;
+        // Shared with the sync callbacks, which run without the session locked.
+        std::shared_ptr<SyncDeltaTracker> delta = std::make_shared<SyncDeltaTracker>();
+        // Read without the session locked, so reads do not wait for a flush or a long scan. Written under it.
+        std::shared_ptr<VersionedItems> items = std::make_shared<VersionedItems>();
+    };
+    // A delegate opened ahead of CreateTable, nullptr while it is still being opened.
+    struct PreparedDelegate {
+        DistributedDB::KvStoreNbDelegate *delegate = nullptr;
+        Executor::TaskId expireTask = Executor::INVALID_TASK_ID;
+    };
+    std::shared_ptr<Session> GetSession(const std::string &key);
+    std::map<std::string, std::shared_ptr<Session>> GetSessions();
+    // Claims key for one CreateTable, false when it exists or another create holds it.
+    bool BeginCreate(const std::string &key);
+    void EndCreate(const std::string &key, std::shared_ptr<Session> session);
+    // Flush timers run on GetExecutor(). Opens, device queries and the pushes that start with one run on
+    // GetOpenExecutor(), so a slow store open or device manager never holds up a flush.
+    std::shared_ptr<ExecutorPool> GetExecutor();
+    std::shared_ptr<ExecutorPool> GetOpenExecutor();
+    void OnDataChanged(const std::string &sessionId, const std::vector<std::string> &keys);
+    void OnRemoteChanged(const std::string &sessionId, const std::vector<std::string> &upserted,
+        const std::vector<std::string> &deleted);
+    // Fills the key index and the item snapshots of a new table from one scan.
+    void LoadItems(const std::string &key, DistributedDB::KvStoreNbDelegate *delegate, VersionedItems &items);
+    static DistributedDB::DBStatus ReadEntries(
+        DistributedDB::KvStoreNbDelegate *delegate, std::map<std::string, Value> &values);
+    DistributedDB::DBStatus OpenDelegate(const std::string &key, DistributedDB::KvStoreNbDelegate *&delegate);
+    void CloseDelegate(DistributedDB::KvStoreNbDelegate *delegate);
+    void OpenPrepared(const std::string &key);
+    DistributedDB::KvStoreNbDelegate *TakePrepared(const std::string &key, bool cancelExpire);
+    void ClosePrepared();
+    void SyncOnCreate(const std::string &key);
+    void SyncAllDevices(const std::string &key);
+    void SyncOnline(const std::string &key, const std::string &deviceId, const SyncCallback &onComplete);
+    SyncScheduler::Priority GetSyncPriority(const std::string &key);
+    uint32_t FlushLocked(const std::string &key, Session &session);
+    uint32_t ScheduleFlushLocked(const std::string &key, Session &session);
+    void DropWriteBufferLocked(Session &session);
+    void OnFlushFailedLocked(const std::string &key, Session &session, const std::map<std::string, Value> &entries);
+    void RetainFlushErrorLocked(Session &session, uint32_t status);
+    uint32_t TakeFlushErrorLocked(const std::string &key, Session &session);
+    void OnWrittenLocked(const std::string &key, Session &session, const std::map<std::string, Value> &entries);
+    void ScheduleSyncLocked(const std::string &key, Session &session, uint32_t delay);
+    void CancelSyncLocked(Session &session);
+    uint32_t PushChanges(const std::string &key);
+    uint32_t SyncLocked(const std::string &key, Session &session, const std::vector<std::string> &deviceIds,
+        DistributedDB::SyncMode mode, const SyncCallback &onComplete);
+    uint32_t PutBatchLocked(const std::string &key, Session &session, const std::map<std::string, Value> &data);
+
     constexpr static const char *DISTRIBUTED_DATASYNC = "ohos.permission.DISTRIBUTED_DATASYNC";
-    std::mutex operationMutex_{};
+    static constexpr size_t MAX_BUFFERED_ITEMS = 32;
+    static constexpr size_t MAX_BUFFERED_BYTES = 64 * 1024;
+    static constexpr uint32_t FLUSH_INTERVAL = 20;
+    static constexpr uint32_t MAX_SYNC_WINDOW = 60000;
+    static constexpr size_t MAX_THREADS = 2;
+    static constexpr size_t MAX_OPEN_THREADS = 2;
+    static constexpr size_t MIN_THREADS = 0;
+    static constexpr size_t MAX_PREPARED_TABLES = 4;
+    static constexpr uint32_t PREPARED_TTL = 10000;
+    std::shared_mutex sessionMutex_{};
+    std::mutex executorMutex_{};
     std::mutex watcherMutex_{};
     std::mutex progressMutex_{};
+    std::mutex listenerMutex_{};
+    std::mutex preparedMutex_{};
     std::shared_ptr<DistributedDB::KvStoreDelegateManager> storeManager_;
-    std::map<std::string, DistributedDB::KvStoreNbDelegate *> delegates_;
-    std::map<std::string, std::shared_ptr<TableWatcher>> observerMap_;
+    std::map<std::string, std::shared_ptr<Session>> sessions_;
+    // Tables between the check of CreateTable and their insert into sessions_, guarded by sessionMutex_.
+    std::set<std::string> creating_;
+    std::map<std::string, PreparedDelegate> prepared_;
     std::shared_ptr<StatusWatcher> statusWatcher_ = nullptr;
     std::shared_ptr<ProgressWatcher> progressWatcher_ = nullptr;
+    std::shared_ptr<ExecutorPool> executor_;
+    std::shared_ptr<ExecutorPool> openExecutor_;
+    DataChangeListener dataChangeListener_;
+    KeyIndex keyIndex_;
 };
 } // namespace OHOS::ObjectStore
 #endif
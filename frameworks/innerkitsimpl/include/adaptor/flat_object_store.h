@@ -16,9 +16,18 @@
 #ifndef FLAT_OBJECT_STORE_H
 #define FLAT_OBJECT_STORE_H
 
+#include <atomic>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "asset_record_tracker.h"
 #include "bytes.h"
+#include "dirty_key_tracker.h"
 #include "flat_object_storage_engine.h"
 #include "distributed_object.h"
+#include "save_queue.h"
+#include "value_cache.h"
 
 namespace OHOS::ObjectStore {
 class FlatObjectWatcher : public TableWatcher {
@@ -30,12 +39,22 @@ public:
         const std::string &sessionId, const std::vector<std::string> &changedData, bool enableTransfer) = 0;
 };
 
+// Requests to the object service. The overloads taking a callback return SUCCESS when it is going to be called
+// with the result, the others wait for it. None of them holds a lock while waiting.
 class CacheManager {
 public:
+    using ResultCallback = std::function<void(uint32_t status)>;
     CacheManager();
     uint32_t Save(const std::string &bundleName, const std::string &sessionId, const std::string &deviceId,
         const std::map<std::string, std::vector<uint8_t>> &objectData);
+    uint32_t Save(const std::string &bundleName, const std::string &sessionId, const std::string &deviceId,
+        const std::map<std::string, std::vector<uint8_t>> &objectData, const ResultCallback &callback);
+    uint32_t SaveDelta(const std::string &bundleName, const std::string &sessionId, const std::string &deviceId,
+        const std::map<std::string, std::vector<uint8_t>> &objectData);
+    uint32_t SaveDelta(const std::string &bundleName, const std::string &sessionId, const std::string &deviceId,
+        const std::map<std::string, std::vector<uint8_t>> &objectData, const ResultCallback &callback);
     uint32_t RevokeSave(const std::string &bundleName, const std::string &sessionId);
+    uint32_t RevokeSave(const std::string &bundleName, const std::string &sessionId, const ResultCallback &callback);
     int32_t ResumeObject(const std::string &bundleName, const std::string &sessionId,
         std::function<void(const std::map<std::string, std::vector<uint8_t>> &data, bool allReady)> &callback);
     int32_t SubscribeDataChange(const std::string &bundleName, const std::string &sessionId,
@@ -50,18 +69,28 @@ private:
     int32_t SaveObject(const std::string &bundleName, const std::string &sessionId,
         const std::string &deviceId, const std::map<std::string, std::vector<uint8_t>> &objectData,
         const std::function<void(const std::map<std::string, int32_t> &)> &callback);
+    int32_t SaveDeltaObject(const std::string &bundleName, const std::string &sessionId,
+        const std::string &deviceId, const std::map<std::string, std::vector<uint8_t>> &objectData,
+        const std::function<void(const std::map<std::string, int32_t> &)> &callback);
+    static uint32_t Wait(const std::function<uint32_t(const ResultCallback &)> &send);
+    static std::function<void(const std::map<std::string, int32_t> &)> ForDevice(
+        const std::string &deviceId, const ResultCallback &callback);
     int32_t RevokeSaveObject(
         const std::string &bundleName, const std::string &sessionId, const std::function<void(int32_t)> &callback);
-    std::mutex mutex_;
     static constexpr uint32_t WAIT_TIME = 5;
 };
 
 class FlatObjectStore {
 public:
-    explicit FlatObjectStore(const std::string &bundleName);
+    explicit FlatObjectStore(const std::string &bundleName, StorageType storageType = STORAGE_DISTRIBUTED);
     ~FlatObjectStore();
     std::string GetBundleName();
     uint32_t CreateObject(const std::string &sessionId);
+    uint32_t CreateObject(const std::string &sessionId, StorageType storageType);
+    void CreateObjectAsync(const std::string &sessionId, const std::function<void(uint32_t)> &callback);
+    void CreateObjectAsync(
+        const std::string &sessionId, StorageType storageType, const std::function<void(uint32_t)> &callback);
+    uint32_t PrepareObject(const std::string &sessionId);
     void ResumeObject(const std::string &sessionId);
     void SubscribeDataChange(const std::string &sessionId);
     void SubscribeProgressChange(const std::string &sessionId);
@@ -72,6 +101,15 @@ public:
     uint32_t SetProgressNotifier(std::shared_ptr<ProgressWatcher> sharedPtr);
     uint32_t Save(const std::string &sessionId, const std::string &deviceId);
     uint32_t RevokeSave(const std::string &sessionId);
+    uint32_t SaveAsync(const std::string &sessionId, const std::string &deviceId, uint32_t timeout,
+        const SaveCallback &callback, SaveId &saveId);
+    uint32_t RevokeSaveAsync(
+        const std::string &sessionId, uint32_t timeout, const SaveCallback &callback, SaveId &saveId);
+    bool CancelSave(SaveId saveId);
+    uint32_t SetSyncPolicy(const std::string &sessionId, SyncPolicy policy, uint32_t window);
+    uint32_t Commit(const std::string &sessionId);
+    uint32_t GetSyncStats(const std::string &sessionId, SyncStats &stats);
+    uint32_t GetVersion(const std::string &sessionId, uint64_t &version);
     void CheckRetrieveCache(const std::string &sessionId);
     void CheckProgressCache(const std::string &sessionId);
     void FilterData(const std::string &sessionId, std::map<std::string, std::vector<uint8_t>> &data);
@@ -84,17 +122,107 @@ public:
     uint32_t GetString(const std::string &sessionId, const std::string &key, std::string &value);
     uint32_t GetComplex(const std::string &sessionId, const std::string &key, std::vector<uint8_t> &value);
     uint32_t GetType(const std::string &sessionId, const std::string &key, Type &type);
+    uint32_t GetView(const std::string &sessionId, const std::string &key, ValueView &value);
+    uint32_t PutView(const std::string &sessionId, const std::string &key, const ValueView &value);
+    uint32_t GetValue(const std::string &sessionId, const std::string &key, DecodedValue &value);
+    uint32_t PutBatch(const std::string &sessionId, const std::map<std::string, FieldValue> &values);
+    uint32_t GetBatch(const std::string &sessionId, const std::vector<std::string> &keys,
+        std::map<std::string, FieldValue> &values);
+    uint32_t GetAll(const std::string &sessionId, std::map<std::string, FieldValue> &values);
+    uint32_t PutAsset(const std::string &sessionId, const std::string &assetKey, const Asset &asset,
+        const std::string &deviceId);
+    uint32_t GetAsset(const std::string &sessionId, const std::string &assetKey, Asset &asset);
+    PropertyHandle GetPropertyHandle(const std::string &key);
+    uint32_t Put(const std::string &sessionId, const PropertyHandle &handle, const DecodedValue &value);
+    uint32_t Get(const std::string &sessionId, const PropertyHandle &handle, DecodedValue &value);
+    uint32_t GetView(const std::string &sessionId, const PropertyHandle &handle, ValueView &value);
+    uint32_t BindSchema(const std::string &sessionId, const ObjectSchema &schema);
+    uint32_t PutRecord(const std::string &sessionId, const SchemaRecord &record);
+    uint32_t GetRecord(const std::string &sessionId, SchemaRecord &record);
     uint32_t BindAssetStore(const std::string &sessionId, AssetBindInfo &bindInfo, Asset &assetValue);
+    uint64_t GetCacheHitCount();
+    uint64_t GetCacheMissCount();
+    void SetCompressThreshold(size_t threshold);
 private:
+    static std::shared_ptr<ObjectStorageEngine> CreateEngine(StorageType storageType);
+    std::shared_ptr<ObjectStorageEngine> GetEngine(StorageType storageType);
+    std::shared_ptr<ObjectStorageEngine> GetEngine(const std::string &sessionId);
+    std::shared_ptr<ObjectStorageEngine> GetOpenedEngine(const std::string &sessionId);
+    uint32_t CheckCreate(const std::shared_ptr<ObjectStorageEngine> &engine, StorageType storageType);
+    // Records the engine of a session not kept in storageEngine_, ERR_EXIST when the session has one already.
+    uint32_t BindEngine(const std::string &sessionId, const std::shared_ptr<ObjectStorageEngine> &engine);
+    void UnbindEngine(const std::string &sessionId, const std::shared_ptr<ObjectStorageEngine> &engine);
+    void OnObjectCreated(const std::string &sessionId);
     uint32_t Put(const std::string &sessionId, const std::string &key, std::vector<uint8_t> value);
     uint32_t Get(const std::string &sessionId, const std::string &key, Bytes &value);
+    // What a save needs once it runs, the store that submitted it may be gone by then.
+    struct SaveTask {
+        std::string bundleName;
+        std::string sessionId;
+        std::string deviceId;
+        std::shared_ptr<ObjectStorageEngine> engine;
+        std::shared_ptr<DirtyKeyTracker> dirtyKeys;
+        std::shared_ptr<CacheManager> cacheManager;
+    };
+    // Saves the keys changed since the last save when the service has its snapshot, else the whole object.
+    static uint32_t StartSave(const std::shared_ptr<SaveTask> &task, const SaveQueue::Done &done);
+    static uint32_t StartFullSave(const std::shared_ptr<SaveTask> &task, const SaveQueue::Done &done);
+    static uint32_t WaitForSave(const std::function<uint32_t(const SaveCallback &, SaveId &)> &submit);
+    uint32_t PutValue(const std::string &sessionId, const std::string &key, Bytes &data, const DecodedValue &value);
+    uint32_t PutField(const std::string &sessionId, const std::string &field, bool isAssetField, Bytes &data,
+        const DecodedValue &value);
+    // Writes values and the already encoded entries of data in one transaction.
+    uint32_t PutItems(const std::string &sessionId, const std::map<std::string, FieldValue> &values,
+        std::map<std::string, std::vector<uint8_t>> &data);
+    bool Compress(const std::string &field, const Bytes &data, Bytes &compressed);
+    static Bytes Encode(const DecodedValue &value);
+    Bytes EncodeValue(const std::string &field, const DecodedValue &value);
+    static uint32_t DecodeValue(Bytes &data, DecodedValue &value);
+    uint32_t GetSharedValue(
+        const std::string &sessionId, const std::string &key, std::shared_ptr<const DecodedValue> &value);
+    uint32_t GetSharedField(
+        const std::string &sessionId, const std::string &field, std::shared_ptr<const DecodedValue> &value);
+    static void MakeView(std::shared_ptr<const DecodedValue> decoded, ValueView &value);
+    bool GetSchema(const std::string &sessionId, ObjectSchema &schema);
+    // Checks a record the tracker does not vouch for, as one an earlier run or a peer wrote, against its sub-fields.
+    bool IsRecordCurrent(const std::string &sessionId, const std::string &assetKey, const Asset &record);
+    static std::vector<std::string> GetKeys(const std::map<std::string, std::vector<uint8_t>> &data);
 
     static constexpr const char* DISTRIBUTED_DATASYNC = "ohos.permission.DISTRIBUTED_DATASYNC";
-    std::shared_ptr<FlatObjectStorageEngine> storageEngine_;
-    CacheManager *cacheManager_ = nullptr;
+    // Handles past this many keys are still returned, only no longer shared.
+    static constexpr size_t MAX_INTERNED_KEYS = 1024;
+    StorageType storageType_ = STORAGE_DISTRIBUTED;
+    // Engine of storageType_, used by every session that did not ask for another storage.
+    std::shared_ptr<ObjectStorageEngine> storageEngine_;
+    ObjectStorageEngine::DataChangeListener dataChangeListener_;
+    std::shared_mutex engineMutex_;
+    // Shared with the callbacks of asynchronous creates. The destructor clears alive under the unique lock, so it
+    // waits for a running callback and none touches the store after that.
+    struct Lifetime {
+        std::shared_mutex mutex;
+        bool alive = true;
+    };
+    std::shared_ptr<Lifetime> lifetime_ = std::make_shared<Lifetime>();
+    // Engine of the other storage type, created by the first session that asks for it.
+    std::shared_ptr<ObjectStorageEngine> secondaryEngine_;
+    std::unordered_map<std::string, std::shared_ptr<ObjectStorageEngine>> sessionEngines_;
+    std::shared_ptr<StatusWatcher> statusNotifier_;
+    std::shared_ptr<ProgressWatcher> progressNotifier_;
+    std::shared_ptr<ValueCache> valueCache_;
+    std::shared_ptr<DirtyKeyTracker> dirtyKeys_;
+    std::shared_ptr<AssetRecordTracker> assetRecords_;
+    // Encoded values larger than this are stored compressed, 0 keeps every value as encoded.
+    std::atomic<size_t> compressThreshold_ = 0;
+    std::shared_ptr<CacheManager> cacheManager_;
     std::mutex mutex_;
     std::mutex progressInfoMutex_;
-    std::vector<std::string> retrievedCache_ {};
+    std::unordered_set<std::string> retrievedCache_ {};
+    std::mutex propertyMutex_;
+    std::unordered_map<std::string, PropertyHandle> properties_;
+    std::mutex schemaMutex_;
+    std::unordered_map<std::string, ObjectSchema> schemas_;
+    // Serializes the read-merge-write of PutRecord.
+    std::mutex recordMutex_;
     std::map<std::string, int32_t> progressInfoCache_;
     std::string bundleName_;
 };
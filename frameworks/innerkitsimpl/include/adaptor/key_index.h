@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef KEY_INDEX_H
+#define KEY_INDEX_H
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace OHOS::ObjectStore {
+// Keys currently stored in each session, so existence checks do not have to scan the store.
+// A session is tracked from Begin() on, but only answers queries once Load() has merged the initial scan.
+class KeyIndex {
+public:
+    void Begin(const std::string &sessionId);
+    void Load(const std::string &sessionId, const std::vector<std::string> &keys);
+    void Insert(const std::string &sessionId, const std::string &key);
+    void Insert(const std::string &sessionId, const std::map<std::string, std::vector<uint8_t>> &data);
+    void Apply(const std::string &sessionId, const std::vector<std::string> &upserted,
+        const std::vector<std::string> &deleted);
+    bool EraseExisting(const std::string &sessionId, std::map<std::string, std::vector<uint8_t>> &data);
+    void Drop(const std::string &sessionId);
+
+private:
+    struct SessionKeys {
+        bool loaded = false;
+        std::unordered_set<std::string> keys;
+        // Deletes seen before Load(), they win over a scan that may have read the key earlier.
+        std::unordered_set<std::string> deleted;
+    };
+    std::mutex mutex_;
+    std::unordered_map<std::string, SessionKeys> sessions_;
+};
+} // namespace OHOS::ObjectStore
+#endif // KEY_INDEX_H
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MEMORY_OBJECT_STORAGE_ENGINE_H
+#define MEMORY_OBJECT_STORAGE_ENGINE_H
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "object_storage_engine.h"
+#include "versioned_items.h"
+
+namespace OHOS::ObjectStore {
+// Keeps every table in process memory. Nothing is persisted or synced between devices,
+// data only reaches other devices through Save and comes back through NotifyChange.
+class MemoryObjectStorageEngine : public ObjectStorageEngine {
+public:
+    MemoryObjectStorageEngine() = default;
+    ~MemoryObjectStorageEngine() override = default;
+    uint32_t Open(const std::string &bundleName) override;
+    uint32_t Close() override;
+    uint32_t DeleteTable(const std::string &key) override;
+    uint32_t CreateTable(const std::string &key) override;
+    uint32_t GetTable(const std::string &key, std::map<std::string, Value> &result) override;
+    uint32_t UpdateItem(const std::string &key, const std::string &itemKey, Value &value) override;
+    uint32_t UpdateItems(const std::string &key, const std::map<std::string, std::vector<uint8_t>> &data) override;
+    uint32_t GetItem(const std::string &key, const std::string &itemKey, Value &value) override;
+    uint32_t GetItems(const std::string &key, std::map<std::string, std::vector<uint8_t>> &data) override;
+    uint32_t ForEachItem(const std::string &key, const ItemVisitor &visitor) override;
+    uint32_t RegisterObserver(const std::string &key, std::shared_ptr<TableWatcher> watcher) override;
+    uint32_t UnRegisterObserver(const std::string &key) override;
+    uint32_t SetStatusNotifier(std::shared_ptr<StatusWatcher> watcher) override;
+    uint32_t SetProgressNotifier(std::shared_ptr<ProgressWatcher> watcher) override;
+    void NotifyStatus(const std::string &sessionId, const std::string &deviceId, const std::string &status) override;
+    void NotifyChange(
+        const std::string &sessionId, const std::map<std::string, std::vector<uint8_t>> &changedData) override;
+    bool NotifyProgress(const std::string &sessionId, int32_t progress) override;
+    uint32_t Flush(const std::string &key) override;
+    void CreateTableAsync(const std::string &key, const std::function<void(uint32_t status)> &callback) override;
+    uint32_t PrepareTable(const std::string &key) override;
+    uint32_t FilterExistingItems(const std::string &key, std::map<std::string, std::vector<uint8_t>> &data) override;
+    uint32_t SetSyncPolicy(const std::string &key, SyncPolicy policy, uint32_t window) override;
+    uint32_t Commit(const std::string &key) override;
+    uint32_t GetSyncStats(const std::string &key, SyncStats &stats) override;
+    uint32_t GetVersion(const std::string &key, uint64_t &version) override;
+    void SetDataChangeListener(DataChangeListener listener) override;
+
+private:
+    struct Session {
+        // Guards the observer, writes to the items are serialized by VersionedItems and reads take no lock.
+        std::mutex mutex;
+        // Loaded before the session is added, so there is always a snapshot to read. The only copy of the items,
+        // so it is not bounded.
+        VersionedItems items{ false };
+        std::shared_ptr<TableWatcher> observer;
+    };
+    std::shared_ptr<Session> GetSession(const std::string &key);
+
+    std::shared_mutex sessionMutex_{};
+    std::mutex watcherMutex_{};
+    std::mutex progressMutex_{};
+    std::unordered_map<std::string, std::shared_ptr<Session>> sessions_;
+    std::shared_ptr<StatusWatcher> statusWatcher_ = nullptr;
+    std::shared_ptr<ProgressWatcher> progressWatcher_ = nullptr;
+};
+} // namespace OHOS::ObjectStore
+#endif // MEMORY_OBJECT_STORAGE_ENGINE_H
@@ -16,6 +16,10 @@
 #ifndef OBJECT_STORAGE_ENGINE_H
 #define OBJECT_STORAGE_ENGINE_H
 
+#include <functional>
+#include <string_view>
+
+#include "distributed_object.h"
 #include "watcher.h"
 
 namespace OHOS::ObjectStore {
@@ -45,6 +49,13 @@ public:
 
 class ObjectStorageEngine {
 public:
+    // Receives one stored entry per call, the views are only valid during the call. Return false to stop.
+    using ItemVisitor = std::function<bool(std::string_view itemKey, const Value &value)>;
+    // Told about every key written by a remote device, independent of the TableWatcher set by the app.
+    using DataChangeListener =
+        std::function<void(const std::string &sessionId, const std::vector<std::string> &keys)>;
+    // GetItem of a key the table does not hold, the status the getters of DistributedObject have always returned.
+    static constexpr uint32_t ERR_ITEM_NOT_FOUND = DistributedDB::DBStatus::NOT_FOUND;
     ObjectStorageEngine(const ObjectStorageEngine &) = delete;
     ObjectStorageEngine &operator=(const ObjectStorageEngine &) = delete;
     ObjectStorageEngine(ObjectStorageEngine &&) = delete;
@@ -60,10 +71,27 @@ public:
     virtual uint32_t UpdateItems(const std::string &key, const std::map<std::string, std::vector<uint8_t>> &data) = 0;
     virtual uint32_t GetItem(const std::string &key, const std::string &itemKey, Value &value) = 0;
     virtual uint32_t GetItems(const std::string &key, std::map<std::string, std::vector<uint8_t>> &data) = 0;
+    virtual uint32_t ForEachItem(const std::string &key, const ItemVisitor &visitor) = 0;
     virtual uint32_t RegisterObserver(const std::string &key, std::shared_ptr<TableWatcher> watcher) = 0;
     virtual uint32_t UnRegisterObserver(const std::string &key) = 0;
     virtual uint32_t SetStatusNotifier(std::shared_ptr<StatusWatcher> watcher) = 0;
     virtual uint32_t SetProgressNotifier(std::shared_ptr<ProgressWatcher> watcher) = 0;
+    virtual void NotifyStatus(const std::string &sessionId, const std::string &deviceId,
+        const std::string &status) = 0;
+    virtual void NotifyChange(
+        const std::string &sessionId, const std::map<std::string, std::vector<uint8_t>> &changedData) = 0;
+    virtual bool NotifyProgress(const std::string &sessionId, int32_t progress) = 0;
+    virtual uint32_t Flush(const std::string &key) = 0;
+    virtual void CreateTableAsync(const std::string &key, const std::function<void(uint32_t status)> &callback) = 0;
+    virtual uint32_t PrepareTable(const std::string &key) = 0;
+    virtual uint32_t FilterExistingItems(const std::string &key, std::map<std::string, std::vector<uint8_t>> &data) = 0;
+    virtual uint32_t SetSyncPolicy(const std::string &key, SyncPolicy policy, uint32_t window) = 0;
+    virtual uint32_t Commit(const std::string &key) = 0;
+    virtual uint32_t GetSyncStats(const std::string &key, SyncStats &stats) = 0;
+    // Counts the writes to the table, local or remote, a change is counted before its watchers are told.
+    virtual uint32_t GetVersion(const std::string &key, uint64_t &version) = 0;
+    virtual void SetDataChangeListener(DataChangeListener listener) = 0;
+    bool isOpened_ = false;
 };
 } // namespace OHOS::ObjectStore
 #endif
\ No newline at end of file
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SAVE_QUEUE_H
+#define SAVE_QUEUE_H
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "executor_pool.h"
+
+namespace OHOS::ObjectStore {
+// Runs the saves and revokes of all sessions in the process. Those of a session run one at a time in submit
+// order, so the service gets them in the order they were made, those of different sessions are in flight
+// together and no thread waits for a result. Each operation completes once: with the status of its task, with
+// ERR_TIMEOUT when its deadline passes first or with ERR_CANCELED. A deadline or cancel of a running operation
+// only detaches its callback, its request is still in flight, so the next one of the session starts when the
+// service answers it. One that never answers holds the session for DETACHED_TIMEOUT at most.
+class SaveQueue : public std::enable_shared_from_this<SaveQueue> {
+public:
+    using Done = std::function<void(uint32_t status)>;
+    // Starts an operation and returns SUCCESS when done is going to be called, any other status completes it.
+    using Task = std::function<uint32_t(const Done &done)>;
+
+    static std::shared_ptr<SaveQueue> GetInstance();
+    // Returns the id of the operation, callback is called with its status on a thread of the queue.
+    // timeout is in milliseconds from now, time spent waiting behind earlier operations counts.
+    uint64_t Submit(const std::string &sessionId, uint32_t timeout, Task task, Done callback);
+    // Returns false when the operation has already completed.
+    bool Cancel(uint64_t id);
+    void CancelAll(const std::string &sessionId);
+    // Operations of the session that have not released their place, a detached running one included.
+    size_t GetPendingCount(const std::string &sessionId);
+
+    static constexpr uint32_t DETACHED_TIMEOUT = 30000;
+
+private:
+    struct Operation {
+        std::string sessionId;
+        Task task;
+        Done callback;
+        Executor::TaskId deadlineTask = Executor::INVALID_TASK_ID;
+        // Completed by its deadline or a cancel while its task was running, waiting for the task to answer.
+        bool detached = false;
+    };
+    std::shared_ptr<ExecutorPool> GetExecutor();
+    void Start(uint64_t id, Task task);
+    // Completes the operation for its caller, returns false when it had already completed.
+    bool Complete(uint64_t id, uint32_t status);
+    // Called with the result of the task, releases the place of the operation in its session.
+    void Finish(uint64_t id, uint32_t status);
+
+    static constexpr size_t MAX_THREADS = 2;
+    static constexpr size_t MIN_THREADS = 0;
+    std::mutex mutex_;
+    std::mutex executorMutex_;
+    std::map<uint64_t, Operation> operations_;
+    // Ids of the operations of each session in submit order, the front one is running.
+    std::map<std::string, std::deque<uint64_t>> sessions_;
+    uint64_t nextId_ = 0;
+    std::shared_ptr<ExecutorPool> executor_;
+};
+} // namespace OHOS::ObjectStore
+#endif // SAVE_QUEUE_H
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SCHEMA_CODEC_H
+#define SCHEMA_CODEC_H
+
+#include "bytes.h"
+#include "object_schema.h"
+
+namespace OHOS::ObjectStore {
+// Encodes the fields of a schema-declared object as one record:
+// [ValueCodec::TAG_SCHEMA][version][varint field count][presence bitmap][2 bit type of each present field]
+// [payload of each present field]
+// Payloads carry no tag, strings and complex values are length prefixed, a bool takes one byte and a double
+// eight. The types let a reader skip the fields a later schema version appended.
+class SchemaCodec final {
+public:
+    static constexpr uint8_t VERSION = 1;
+    static constexpr size_t MAX_FIELD_COUNT = 256;
+
+    SchemaCodec() = delete;
+    ~SchemaCodec() = delete;
+
+    static bool IsRecord(const Bytes &data);
+    // Fails when a set field is not declared by schema or holds another type.
+    static uint32_t Encode(const ObjectSchema &schema, const SchemaRecord &record, Bytes &data);
+    // Fields appended by a later version of schema are dropped, record has the field count of schema.
+    static uint32_t Decode(const ObjectSchema &schema, const Bytes &data, SchemaRecord &record);
+
+private:
+    static void PutPayload(const FieldValue &value, Bytes &data);
+    static bool GetPayload(Type type, const uint8_t *&src, const uint8_t *end, FieldValue &value);
+};
+} // namespace OHOS::ObjectStore
+#endif // SCHEMA_CODEC_H
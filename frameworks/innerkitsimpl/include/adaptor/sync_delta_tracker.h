@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SYNC_DELTA_TRACKER_H
+#define SYNC_DELTA_TRACKER_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "distributed_object.h"
+
+namespace OHOS::ObjectStore {
+// Entries of one table written since the last sync each peer acknowledged.
+// Every write gets the next sequence number, a peer has received everything up to its acknowledged one.
+// A peer never synced has acknowledged nothing, so all entries are pending for it.
+class SyncDeltaTracker {
+public:
+    struct Delta {
+        uint64_t seq = 0;
+        uint64_t entries = 0;
+        uint64_t bytes = 0;
+    };
+
+    void OnWritten(const std::map<std::string, std::vector<uint8_t>> &entries);
+    // Counts what a push to deviceIds carries, seq is to be acknowledged by the devices the push reached.
+    Delta GetPending(const std::vector<std::string> &deviceIds);
+    void OnPushed(const Delta &delta);
+    void OnPulled();
+    void Acknowledge(const std::string &deviceId, uint64_t seq);
+    SyncStats GetStats();
+
+private:
+    struct Entry {
+        uint64_t seq = 0;
+        uint64_t bytes = 0;
+    };
+
+    std::mutex mutex_;
+    uint64_t seq_ = 0;
+    std::map<std::string, Entry> entries_;
+    std::map<std::string, uint64_t> acked_;
+    SyncStats stats_;
+};
+} // namespace OHOS::ObjectStore
+#endif // SYNC_DELTA_TRACKER_H
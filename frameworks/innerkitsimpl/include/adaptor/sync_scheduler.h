@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SYNC_SCHEDULER_H
+#define SYNC_SCHEDULER_H
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+
+#include "executor_pool.h"
+
+namespace OHOS::ObjectStore {
+// Runs the syncs of all stores in the process, at most maxPerDevice at a time with each device.
+// Waiting requests start by priority, then in order. A request for a store and device that is already
+// waiting is merged into the waiting one. A sync that fails is retried after a randomized, growing delay, so
+// the stores of a device that just came online do not retry in step. A sync past its timeout keeps its slot
+// and is retried only once it completes, as it may still be running. One that has not completed after another
+// timeout is given up without a retry, so a lost completion does not block the device for good.
+class SyncScheduler : public std::enable_shared_from_this<SyncScheduler> {
+public:
+    enum Priority : uint8_t {
+        PRIORITY_HIGH = 0,
+        PRIORITY_LOW,
+        PRIORITY_BUTT,
+    };
+    using Done = std::function<void(bool succeeded)>;
+    // Starts a sync and returns SUCCESS when done is going to be called, any other status drops the request.
+    using Task = std::function<uint32_t(const Done &done)>;
+    struct Metrics {
+        size_t queueDepth = 0;
+        size_t running = 0;
+        uint64_t submitted = 0;
+        uint64_t deduplicated = 0;
+        uint64_t started = 0;
+        uint64_t retried = 0;
+        uint64_t failed = 0;
+        uint64_t timedOut = 0;
+        uint64_t totalWaitMs = 0;
+        uint64_t maxWaitMs = 0;
+    };
+
+    static std::shared_ptr<SyncScheduler> GetInstance();
+    explicit SyncScheduler(size_t maxPerDevice = MAX_PER_DEVICE, uint32_t retryDelay = RETRY_DELAY,
+        uint32_t timeout = SYNC_TIMEOUT);
+    void Submit(const std::string &storeId, const std::string &deviceId, Priority priority, Task task);
+    Metrics GetMetrics();
+
+private:
+    using Clock = std::chrono::steady_clock;
+    struct Request {
+        std::string storeId;
+        std::string deviceId;
+        Priority priority = PRIORITY_LOW;
+        Task task;
+        uint32_t attempts = 0;
+        Clock::time_point enqueued;
+    };
+    struct Running {
+        Request request;
+        Executor::TaskId timeoutTask = Executor::INVALID_TASK_ID;
+        bool timedOut = false;
+    };
+    struct DeviceQueue {
+        size_t running = 0;
+        std::deque<Request> waiting[PRIORITY_BUTT];
+    };
+    std::shared_ptr<ExecutorPool> GetExecutor();
+    void Enqueue(Request request);
+    bool MergeLocked(Request &request);
+    std::map<uint64_t, Task> TakeRunnableLocked(const std::string &deviceId);
+    void Start(std::map<uint64_t, Task> runnable);
+    void Finish(uint64_t runId, bool succeeded, bool retry);
+    void OnTimeout(uint64_t runId);
+    void RetryLocked(Request request);
+
+    static constexpr size_t MAX_PER_DEVICE = 2;
+    static constexpr uint32_t MAX_RETRIES = 3;
+    static constexpr uint32_t RETRY_DELAY = 500;
+    static constexpr uint32_t SYNC_TIMEOUT = 30000;
+    static constexpr size_t MAX_THREADS = 2;
+    static constexpr size_t MIN_THREADS = 0;
+    const size_t maxPerDevice_;
+    const uint32_t retryDelay_;
+    const uint32_t timeout_;
+    std::mutex mutex_;
+    std::mutex executorMutex_;
+    std::map<std::string, DeviceQueue> devices_;
+    std::set<std::pair<std::string, std::string>> waiting_;
+    std::map<uint64_t, Running> running_;
+    uint64_t nextRunId_ = 0;
+    Metrics metrics_;
+    std::mt19937 random_;
+    std::shared_ptr<ExecutorPool> executor_;
+};
+} // namespace OHOS::ObjectStore
+#endif // SYNC_SCHEDULER_H
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef VALUE_CACHE_H
+#define VALUE_CACHE_H
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "distributed_object.h"
+#include "value_codec.h"
+
+namespace OHOS::ObjectStore {
+class ValueCache {
+public:
+    explicit ValueCache(size_t capacity = DEFAULT_CAPACITY);
+    ~ValueCache() = default;
+    bool Get(const std::string &sessionId, const std::string &key, DecodedValue &value);
+    // Shares the cached value instead of copying it, nullptr on a miss.
+    std::shared_ptr<const DecodedValue> Get(const std::string &sessionId, const std::string &key);
+    // Write-through after a local put, generation taken before the store write. If anything was written or
+    // invalidated since, the store may hold the other value, so the entries are dropped instead.
+    void Put(const std::string &sessionId, const std::string &key, const DecodedValue &value, uint64_t generation);
+    void Put(const std::string &sessionId, const std::vector<std::pair<std::string, DecodedValue>> &values,
+        uint64_t generation);
+    // Fill after a miss, dropped if anything was written or invalidated since generation was taken.
+    void Fill(const std::string &sessionId, const std::string &key, const DecodedValue &value, uint64_t generation);
+    void Fill(const std::string &sessionId, const std::string &key, std::shared_ptr<const DecodedValue> value,
+        uint64_t generation);
+    void Invalidate(const std::string &sessionId, const std::vector<std::string> &keys);
+    void Invalidate(const std::string &sessionId);
+    uint64_t GetGeneration();
+    uint64_t GetHitCount() const;
+    uint64_t GetMissCount() const;
+    size_t GetSize();
+
+    static constexpr size_t DEFAULT_CAPACITY = 1024 * 1024;
+
+private:
+    using LruList = std::list<std::pair<std::string, std::string>>;
+    struct Entry {
+        std::shared_ptr<const DecodedValue> value;
+        size_t size = 0;
+        LruList::iterator lru;
+    };
+    static size_t SizeOf(const std::string &key, const DecodedValue &value);
+    void InsertLocked(const std::string &sessionId, const std::string &key, std::shared_ptr<const DecodedValue> value);
+    void EraseLocked(std::unordered_map<std::string, Entry> &entries, const std::string &key);
+
+    static constexpr size_t ENTRY_OVERHEAD = 64;
+    std::mutex mutex_;
+    std::map<std::string, std::unordered_map<std::string, Entry>> sessions_;
+    LruList lru_;
+    size_t capacity_;
+    size_t size_ = 0;
+    uint64_t generation_ = 0;
+    std::atomic<uint64_t> hits_ = 0;
+    std::atomic<uint64_t> misses_ = 0;
+};
+} // namespace OHOS::ObjectStore
+#endif // VALUE_CACHE_H
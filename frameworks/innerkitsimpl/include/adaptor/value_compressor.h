@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VALUE_COMPRESSOR_H
+#define VALUE_COMPRESSOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "bytes.h"
+
+namespace OHOS::ObjectStore {
+// Wraps an encoded field value into a compressed one:
+// [ValueCodec::TAG_COMPRESSED][varint length of the encoded value][LZ77 block of the encoded value]
+// The block uses LZ4 style sequences, a token with literal and match length nibbles, the literals,
+// a two byte little endian offset and the extra match length. The last sequence has literals only.
+class ValueCompressor final {
+public:
+    // Larger values are rejected on read, no field can come near it once synced over the 4M MTU.
+    static constexpr size_t MAX_VALUE_LEN = 64 * 1024 * 1024;
+
+    ValueCompressor() = delete;
+    ~ValueCompressor() = delete;
+
+    static bool IsCompressed(const Bytes &data);
+    // Returns false and leaves compressed untouched when the result would not be smaller than encoded.
+    static bool Compress(const Bytes &encoded, Bytes &compressed);
+    static uint32_t Decompress(const Bytes &compressed, Bytes &encoded);
+
+private:
+    static constexpr size_t MIN_MATCH = 4;
+    static constexpr size_t MAX_OFFSET = 65535;
+    static constexpr uint32_t HASH_BITS = 12;
+    static constexpr uint8_t RUN_MASK = 15;
+    static constexpr uint8_t LEN_EXTEND = 255;
+
+    static size_t CompressBlock(const uint8_t *src, size_t len, uint8_t *dst);
+    // Fills dst exactly, fails on any sequence that reads or writes out of bounds.
+    static bool DecompressBlock(const uint8_t *src, size_t len, Bytes &dst);
+    static uint8_t *PutLength(uint8_t *dst, size_t len);
+    static bool GetLength(const uint8_t *&src, const uint8_t *end, size_t &len);
+};
+} // namespace OHOS::ObjectStore
+#endif // VALUE_COMPRESSOR_H
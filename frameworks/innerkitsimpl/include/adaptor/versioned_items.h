@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VERSIONED_ITEMS_H
+#define VERSIONED_ITEMS_H
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace OHOS::ObjectStore {
+// The items of a session at one version. Never changed once published, readers keep it as long as they need.
+// A shared base plus the writes made since it was built, so publishing a write copies only those writes.
+struct ItemSnapshot {
+    using Item = std::shared_ptr<const std::vector<uint8_t>>;
+    using Items = std::map<std::string, Item>;
+    using Visitor = std::function<bool(const std::string &key, const std::vector<uint8_t> &value)>;
+
+    // nullptr when the key is not held.
+    Item Find(const std::string &key) const;
+    // Visits the items in key order until visitor returns false.
+    void ForEach(const Visitor &visitor) const;
+
+    uint64_t version = 0;
+    size_t size = 0;
+    // Keys and values together.
+    size_t bytes = 0;
+    std::shared_ptr<const Items> base = std::make_shared<const Items>();
+    // Written since base was built, nullptr for a key deleted since.
+    Items delta;
+};
+
+// Items of one session as a chain of immutable snapshots. Each write publishes a new snapshot that shares the
+// unchanged values with the previous one, readers take the current one with an atomic load and never wait for a
+// writer. Writes before Load() are kept and applied over the initial scan, which may have missed them.
+// Bounded instances share MAX_SHARED_BYTES, one that would go over it drops its snapshots until Reload() brings
+// them back from a new scan of the store.
+class VersionedItems {
+public:
+    using Snapshot = std::shared_ptr<const ItemSnapshot>;
+
+    // An unbounded instance is the only copy of its items and is never dropped for its size.
+    explicit VersionedItems(bool bounded = true);
+    ~VersionedItems();
+    // nullptr until Load() or after Reset(), readers then go to the store.
+    Snapshot Get() const;
+    uint64_t GetVersion() const;
+    // True once Reset() or the shared budget dropped the snapshots, writes are ignored until a Reload().
+    bool IsDropped();
+    void Load(std::map<std::string, std::vector<uint8_t>> items);
+    // True when the shared budget dropped the snapshots and now has room for them again.
+    bool CanReload();
+    // Publishes items scanned from the store after the shared budget dropped the snapshots, the caller holds
+    // off writes until it returns. False after Reset() or when they still do not fit.
+    bool Reload(std::map<std::string, std::vector<uint8_t>> items);
+    void Put(const std::string &key, const std::vector<uint8_t> &value);
+    void Put(const std::map<std::string, std::vector<uint8_t>> &upserted,
+        const std::vector<std::string> &deleted = {});
+    // Drops the snapshots for good once they may no longer match the store.
+    void Reset();
+
+    static constexpr size_t MAX_SHARED_BYTES = 1024 * 1024;
+
+private:
+    void LoadLocked(std::map<std::string, std::vector<uint8_t>> items);
+    void PublishLocked(const std::map<std::string, std::vector<uint8_t>> &upserted,
+        const std::vector<std::string> &deleted);
+    // Folds the delta into a new base once copying it costs more than rebuilding the base now and then.
+    static void CompactIfNeeded(ItemSnapshot &snapshot);
+    // Accounts bytes as what this instance holds, false when that would go over the shared budget.
+    bool ChargeLocked(size_t bytes);
+    void DropLocked();
+    void DropOverBudgetLocked(size_t bytes);
+
+    static constexpr size_t MIN_DELTA_SIZE = 32;
+    static std::atomic<size_t> sharedBytes_;
+    // Serializes the writers only, readers load current_ without it.
+    std::mutex mutex_;
+    Snapshot current_;
+    std::atomic<uint64_t> version_ = 0;
+    bool loaded_ = false;
+    const bool bounded_;
+    size_t charged_ = 0;
+    // Set while the shared budget keeps the snapshots dropped, with the bytes they needed then.
+    bool overBudget_ = false;
+    size_t droppedBytes_ = 0;
+    std::map<std::string, std::optional<std::vector<uint8_t>>> pending_;
+};
+} // namespace OHOS::ObjectStore
+#endif // VERSIONED_ITEMS_H
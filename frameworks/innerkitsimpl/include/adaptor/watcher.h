@@ -16,6 +16,7 @@
 #ifndef WATCHER_H
 #define WATCHER_H
 
+#include "changed_keys.h"
 #include "kv_store_delegate_manager.h"
 
 namespace OHOS::ObjectStore {
@@ -25,6 +26,8 @@ public:
     virtual ~Watcher() = default;
     virtual void OnChanged(
         const std::string &sessionId, const std::vector<std::string> &changedData, bool enableTransfer) = 0;
+    // Receives the classified keys of one notification, by default they are copied and passed to OnChanged.
+    virtual void OnChangedKeys(const std::string &sessionId, const ChangedKeys &changedKeys, bool enableTransfer);
     void OnChange(const DistributedDB::KvStoreChangedData &data) override;
 
 private:
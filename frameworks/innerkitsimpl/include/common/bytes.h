@@ -16,12 +16,34 @@
 #ifndef BYTES_H
 #define BYTES_H
 
+#include <string_view>
 #include <vector>
 
 namespace OHOS::ObjectStore {
 using Bytes = std::vector<uint8_t>;
 static constexpr const char *FIELDS_PREFIX = "p_";
 static constexpr int32_t FIELDS_PREFIX_LEN = 2;
+// Records live outside the property prefix, so no property name collides with them and they are never returned
+// by GetAll. Only a change of the schema record is reported to watchers, through ObjectWatcher::OnRecordChanged.
+static constexpr const char *RECORDS_PREFIX = "r_";
+static constexpr int32_t RECORDS_PREFIX_LEN = 2;
+// Whole asset in one value, stored under RECORDS_PREFIX + assetKey + ASSET_RECORD_SUFFIX next to the
+// sub-fields which older peers still read.
+static constexpr const char *ASSET_RECORD_SUFFIX = ".record";
+// Fields of a schema-declared object, written by PutRecord as one value. Asset keys are never empty.
+static constexpr const char *SCHEMA_RECORD_KEY = "r_.schema";
+
+inline bool IsFieldKey(std::string_view storedKey)
+{
+    return storedKey.compare(0, FIELDS_PREFIX_LEN, FIELDS_PREFIX) == 0;
+}
+
+// Keys a save sends to the service. Asset records are left out, their sub-fields carry the same asset, the schema
+// record is the only copy of its fields.
+inline bool IsSavedKey(std::string_view storedKey)
+{
+    return IsFieldKey(storedKey) || storedKey == SCHEMA_RECORD_KEY;
+}
 static constexpr const char STRING_PREFIX[] = "[STRING]";
 static constexpr int32_t STRING_PREFIX_LEN = sizeof(STRING_PREFIX) - 1;
 } // namespace OHOS::ObjectStore
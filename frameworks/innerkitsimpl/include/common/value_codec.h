@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VALUE_CODEC_H
+#define VALUE_CODEC_H
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include "bytes.h"
+#include "distributed_object.h"
+#include "logger.h"
+#include "objectstore_errors.h"
+
+namespace OHOS::ObjectStore {
+// Alternatives are ordered like Type, so index() is the stored type tag.
+using DecodedValue = FieldValue;
+
+// Encodes a field value as a one byte tag followed by the payload.
+// The layout is the one BytesUtils::PutNum writes: the tags are the values of Type and fixed width
+// payloads are stored with their bytes reversed, so data written by either side stays readable by the other.
+// Tags from TAG_EXTENDED on belong to types added by this codec, older readers reject them as unknown.
+class ValueCodec final {
+public:
+    static constexpr uint8_t TAG_EXTENDED = 0x40;
+    static constexpr uint8_t TAG_VARINT = TAG_EXTENDED;
+    // A whole encoded value compressed by ValueCompressor, never returned by Decode.
+    static constexpr uint8_t TAG_COMPRESSED = TAG_EXTENDED + 1;
+    // A whole asset written by AssetCodec, never returned by Decode.
+    static constexpr uint8_t TAG_ASSET = TAG_EXTENDED + 2;
+    // The fields of a schema-declared object written by SchemaCodec, never returned by Decode.
+    static constexpr uint8_t TAG_SCHEMA = TAG_EXTENDED + 3;
+    static constexpr size_t TAG_LEN = sizeof(uint8_t);
+    static constexpr size_t MAX_VARINT_LEN = 10;
+
+    ValueCodec() = delete;
+    ~ValueCodec() = delete;
+
+    static Bytes EncodeString(std::string_view value)
+    {
+        Bytes data(TAG_LEN + value.size());
+        data[0] = TYPE_STRING;
+        if (!value.empty()) {
+            std::memcpy(data.data() + TAG_LEN, value.data(), value.size());
+        }
+        return data;
+    }
+
+    static Bytes EncodeBoolean(bool value)
+    {
+        return Bytes{ TYPE_BOOLEAN, static_cast<uint8_t>(value ? 1 : 0) };
+    }
+
+    static Bytes EncodeDouble(double value)
+    {
+        Bytes data(TAG_LEN + sizeof(value));
+        data[0] = TYPE_DOUBLE;
+        StoreFixed(data.data() + TAG_LEN, value);
+        return data;
+    }
+
+    static Bytes EncodeComplex(const Bytes &value)
+    {
+        return EncodeComplex(value.data(), value.size());
+    }
+
+    static Bytes EncodeComplex(const uint8_t *value, size_t len)
+    {
+        Bytes data(TAG_LEN + len);
+        data[0] = TYPE_COMPLEX;
+        if (len != 0) {
+            std::memcpy(data.data() + TAG_LEN, value, len);
+        }
+        return data;
+    }
+
+    // Zigzag varint, small magnitudes of either sign take one or two bytes.
+    static Bytes EncodeVarint(int64_t value)
+    {
+        uint8_t buffer[TAG_LEN + MAX_VARINT_LEN];
+        buffer[0] = TAG_VARINT;
+        uint64_t zigzag = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        size_t len = TAG_LEN;
+        while (zigzag >= 0x80) {
+            buffer[len++] = static_cast<uint8_t>(zigzag | 0x80);
+            zigzag >>= 7;
+        }
+        buffer[len++] = static_cast<uint8_t>(zigzag);
+        return Bytes(buffer, buffer + len);
+    }
+
+    static uint32_t DecodeTag(const Bytes &data, uint8_t &tag)
+    {
+        if (data.size() < TAG_LEN) {
+            LOG_ERROR("DecodeTag data.size() %{public}zu", data.size());
+            return ERR_DATA_LEN;
+        }
+        tag = data[0];
+        return SUCCESS;
+    }
+
+    // The view points into data and is only valid while data is not changed.
+    static uint32_t DecodeString(const Bytes &data, std::string_view &value)
+    {
+        uint32_t status = CheckTag(data, TYPE_STRING, 0);
+        if (status != SUCCESS) {
+            return status;
+        }
+        value = std::string_view(reinterpret_cast<const char *>(data.data()) + TAG_LEN, data.size() - TAG_LEN);
+        return SUCCESS;
+    }
+
+    static uint32_t DecodeBoolean(const Bytes &data, bool &value)
+    {
+        uint32_t status = CheckTag(data, TYPE_BOOLEAN, sizeof(value));
+        if (status != SUCCESS) {
+            return status;
+        }
+        value = data[TAG_LEN] != 0;
+        return SUCCESS;
+    }
+
+    static uint32_t DecodeDouble(const Bytes &data, double &value)
+    {
+        uint32_t status = CheckTag(data, TYPE_DOUBLE, sizeof(value));
+        if (status != SUCCESS) {
+            return status;
+        }
+        value = LoadFixed<double>(data.data() + TAG_LEN);
+        return SUCCESS;
+    }
+
+    // The payload starts at offset TAG_LEN of data, callers that only read it need no copy.
+    static uint32_t DecodeComplex(const Bytes &data, const uint8_t *&value, size_t &len)
+    {
+        uint32_t status = CheckTag(data, TYPE_COMPLEX, 0);
+        if (status != SUCCESS) {
+            return status;
+        }
+        value = data.data() + TAG_LEN;
+        len = data.size() - TAG_LEN;
+        return SUCCESS;
+    }
+
+    static uint32_t DecodeVarint(const Bytes &data, int64_t &value)
+    {
+        uint32_t status = CheckTag(data, TAG_VARINT, 1);
+        if (status != SUCCESS) {
+            return status;
+        }
+        uint64_t zigzag = 0;
+        size_t end = std::min(data.size(), TAG_LEN + MAX_VARINT_LEN);
+        for (size_t i = TAG_LEN, shift = 0; i < end; ++i, shift += 7) {
+            zigzag |= static_cast<uint64_t>(data[i] & 0x7F) << shift;
+            if ((data[i] & 0x80) == 0) {
+                value = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+                return SUCCESS;
+            }
+        }
+        LOG_ERROR("DecodeVarint unterminated, size:%{public}zu", data.size());
+        return ERR_DATA_LEN;
+    }
+
+    // Decodes any of the Type values, the result holds the alternative whose index is the tag.
+    static uint32_t Decode(const Bytes &data, DecodedValue &value)
+    {
+        uint8_t tag = 0;
+        uint32_t status = DecodeTag(data, tag);
+        if (status != SUCCESS) {
+            return status;
+        }
+        switch (tag) {
+            case TYPE_STRING:
+                value.emplace<std::string>(reinterpret_cast<const char *>(data.data()) + TAG_LEN,
+                    data.size() - TAG_LEN);
+                return SUCCESS;
+            case TYPE_BOOLEAN: {
+                bool result = false;
+                status = DecodeBoolean(data, result);
+                value = result;
+                return status;
+            }
+            case TYPE_DOUBLE: {
+                double result = 0;
+                status = DecodeDouble(data, result);
+                value = result;
+                return status;
+            }
+            case TYPE_COMPLEX:
+                value.emplace<std::vector<uint8_t>>(data.begin() + TAG_LEN, data.end());
+                return SUCCESS;
+            default:
+                LOG_ERROR("unknown type %{public}d", tag);
+                return ERR_DATA_LEN;
+        }
+    }
+
+    // Unsigned varint without a tag, for the lengths and counts inside records.
+    static void PutVarint(uint64_t value, Bytes &data)
+    {
+        while (value >= 0x80) {
+            data.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        data.push_back(static_cast<uint8_t>(value));
+    }
+
+    // Advances src past the varint, fails when it runs past end.
+    static bool GetVarint(const uint8_t *&src, const uint8_t *end, uint64_t &value)
+    {
+        value = 0;
+        for (uint32_t shift = 0; src != end && shift < sizeof(uint64_t) * 8; shift += 7) {
+            value |= static_cast<uint64_t>(*src & 0x7F) << shift;
+            if ((*src++ & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Fixed width payloads in the byte order of version 1.
+    template<typename T>
+    static void StoreFixed(uint8_t *dst, T value)
+    {
+        static_assert(std::is_trivially_copyable_v<T> && (sizeof(T) == sizeof(uint16_t) ||
+            sizeof(T) == sizeof(uint32_t) || sizeof(T) == sizeof(uint64_t)), "unsupported fixed width type");
+        Raw<T> raw;
+        std::memcpy(&raw, &value, sizeof(T));
+        raw = Reverse<T>(raw);
+        std::memcpy(dst, &raw, sizeof(T));
+    }
+
+    template<typename T>
+    static T LoadFixed(const uint8_t *src)
+    {
+        Raw<T> raw;
+        std::memcpy(&raw, src, sizeof(T));
+        raw = Reverse<T>(raw);
+        T value;
+        std::memcpy(&value, &raw, sizeof(T));
+        return value;
+    }
+
+private:
+    static uint32_t CheckTag(const Bytes &data, uint8_t tag, size_t minPayload)
+    {
+        if (data.size() < TAG_LEN + minPayload || data[0] != tag) {
+            LOG_ERROR("tag %{public}d expected, size:%{public}zu", tag, data.size());
+            return ERR_DATA_LEN;
+        }
+        return SUCCESS;
+    }
+
+    template<typename T>
+    using Raw = std::conditional_t<sizeof(T) == sizeof(uint64_t), uint64_t,
+        std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint16_t>>;
+
+    template<typename T>
+    static Raw<T> Reverse(Raw<T> raw)
+    {
+        if constexpr (sizeof(T) == sizeof(uint64_t)) {
+            return __builtin_bswap64(raw);
+        } else if constexpr (sizeof(T) == sizeof(uint32_t)) {
+            return __builtin_bswap32(raw);
+        } else {
+            return __builtin_bswap16(raw);
+        }
+    }
+};
+} // namespace OHOS::ObjectStore
+#endif // VALUE_CODEC_H
@@ -32,6 +32,7 @@ enum class ObjectServiceInterfaceCode : int8_t {
     OBJECTSTORE_IS_CONTINUE,
     OBJECTSTORE_REGISTER_PROGRESS,
     OBJECTSTORE_UNREGISTER_PROGRESS,
+    OBJECTSTORE_SAVE_DELTA,
     OBJECTSTORE_SERVICE_CMD_MAX
 };
 
@@ -25,6 +25,10 @@ public:
     uint32_t Get(const std::string &sessionId, DistributedObject **object) override;
     DistributedObject *CreateObject(const std::string &sessionId) override;
     DistributedObject *CreateObject(const std::string &sessionId, uint32_t &status) override;
+    DistributedObject *CreateObject(
+        const std::string &sessionId, StorageType storageType, uint32_t &status) override;
+    void CreateObjectAsync(const std::string &sessionId, const CreateCallback &callback) override;
+    uint32_t PrepareObject(const std::string &sessionId) override;
     uint32_t DeleteObject(const std::string &sessionId) override;
     uint32_t Watch(DistributedObject *object, std::shared_ptr<ObjectWatcher> watcher) override;
     uint32_t UnWatch(DistributedObject *object) override;
@@ -32,6 +36,7 @@ public:
     uint32_t SetProgressNotifier(std::shared_ptr<ProgressNotifier> notifier) override;
     void NotifyCachedStatus(const std::string &sessionId) override;
     void NotifyProgressStatus(const std::string &sessionId) override;
+    void SetCompressThreshold(size_t threshold) override;
 };
 } // namespace OHOS::ObjectStore
 #endif // DISTRIBUTED_OBJECTSTORE_IMPL_LITE_H
\ No newline at end of file
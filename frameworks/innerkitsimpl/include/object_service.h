@@ -24,6 +24,10 @@ public:
     virtual int32_t ObjectStoreSave(const std::string &bundleName, const std::string &sessionId,
         const std::string &deviceId, const std::map<std::string, std::vector<uint8_t>> &data,
         sptr<IRemoteObject> callback) = 0;
+    // Merges data into the snapshot already saved for deviceId, fails if the service has no such snapshot.
+    virtual int32_t ObjectStoreSaveDelta(const std::string &bundleName, const std::string &sessionId,
+        const std::string &deviceId, const std::map<std::string, std::vector<uint8_t>> &data,
+        sptr<IRemoteObject> callback) = 0;
     virtual int32_t ObjectStoreRetrieve(
         const std::string &bundleName, const std::string &sessionId, sptr<IRemoteObject> callback) = 0;
     virtual int32_t ObjectStoreRevokeSave(
@@ -16,6 +16,7 @@
 #ifndef DISTRIBUTED_OBJECT_SERVICE_PROXY_H
 #define DISTRIBUTED_OBJECT_SERVICE_PROXY_H
 
+#include <atomic>
 #include <iremote_proxy.h>
 #include "iobject_service.h"
 
@@ -27,6 +28,9 @@ public:
     int32_t ObjectStoreSave(const std::string &bundleName, const std::string &sessionId,
         const std::string &deviceId, const std::map<std::string, std::vector<uint8_t>> &data,
         sptr<IRemoteObject> callback) override;
+    int32_t ObjectStoreSaveDelta(const std::string &bundleName, const std::string &sessionId,
+        const std::string &deviceId, const std::map<std::string, std::vector<uint8_t>> &data,
+        sptr<IRemoteObject> callback) override;
     int32_t ObjectStoreRetrieve(
         const std::string &bundleName, const std::string &sessionId, sptr<IRemoteObject> callback) override;
     int32_t ObjectStoreRevokeSave(const std::string &bundleName, const std::string &sessionId,
@@ -46,6 +50,10 @@ public:
     int32_t IsContinue(bool &result) override;
 private:
     static inline BrokerDelegator<ObjectServiceProxy> delegator_;
+    // Set once the service did not know the delta save code, a service without it is not asked again. Other
+    // SendRequest failures leave it clear. The proxy is dropped when the service dies, so a restarted one is
+    // asked once more.
+    std::atomic<bool> deltaUnsupported_ = false;
 };
 } // namespace OHOS::DistributedObject
 #endif
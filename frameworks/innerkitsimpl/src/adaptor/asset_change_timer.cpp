@@ -118,32 +118,10 @@ uint32_t AssetChangeTimer::HandleAssetChanges(const std::string &sessionId, cons
 
 bool AssetChangeTimer::GetAssetValue(const std::string &sessionId, const std::string &assetKey, Asset &assetValue)
 {
-    double doubleStatus;
-    if (flatObjectStore_->GetDouble(sessionId, assetKey + STATUS_SUFFIX, doubleStatus) == SUCCESS) {
-        assetValue.status = static_cast<uint32_t>(doubleStatus);
+    if (flatObjectStore_->GetAsset(sessionId, assetKey, assetValue) != SUCCESS) {
+        return false;
     }
-    bool isComplete = true;
-    isComplete = isComplete &&
-        (flatObjectStore_->GetString(sessionId, assetKey + NAME_SUFFIX, assetValue.name) == SUCCESS);
-    isComplete = isComplete &&
-        (flatObjectStore_->GetString(sessionId, assetKey + URI_SUFFIX, assetValue.uri) == SUCCESS);
-    isComplete = isComplete &&
-        (flatObjectStore_->GetString(sessionId, assetKey + PATH_SUFFIX, assetValue.path) == SUCCESS);
-    isComplete = isComplete &&
-        (flatObjectStore_->GetString(sessionId, assetKey + CREATE_TIME_SUFFIX, assetValue.createTime) == SUCCESS);
-    isComplete = isComplete &&
-        (flatObjectStore_->GetString(sessionId, assetKey + MODIFY_TIME_SUFFIX, assetValue.modifyTime) == SUCCESS);
-    isComplete = isComplete &&
-        (flatObjectStore_->GetString(sessionId, assetKey + SIZE_SUFFIX, assetValue.size) == SUCCESS);
-    if (isComplete) {
-        assetValue.name = assetValue.name.substr(STRING_PREFIX_LEN);
-        assetValue.uri = assetValue.uri.substr(STRING_PREFIX_LEN);
-        assetValue.path = assetValue.path.substr(STRING_PREFIX_LEN);
-        assetValue.createTime = assetValue.createTime.substr(STRING_PREFIX_LEN);
-        assetValue.modifyTime = assetValue.modifyTime.substr(STRING_PREFIX_LEN);
-        assetValue.size = assetValue.size.substr(STRING_PREFIX_LEN);
-        assetValue.hash = assetValue.modifyTime + "_" + assetValue.size;
-    }
-    return isComplete;
+    assetValue.hash = assetValue.modifyTime + "_" + assetValue.size;
+    return true;
 }
 } // namespace OHOS::ObjectStore
\ No newline at end of file
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asset_codec.h"
+
+#include <iterator>
+#include <limits>
+
+#include "logger.h"
+#include "objectstore_errors.h"
+#include "value_codec.h"
+
+namespace OHOS::ObjectStore {
+namespace {
+struct StringField {
+    const char *suffix;
+    std::string Asset::*member;
+    bool required;
+};
+
+// Record order of the string members, never reorder, new members go at the end.
+constexpr StringField STRING_FIELDS[] = {
+    { ID_SUFFIX, &Asset::id, false },
+    { NAME_SUFFIX, &Asset::name, true },
+    { URI_SUFFIX, &Asset::uri, true },
+    { PATH_SUFFIX, &Asset::path, true },
+    { CREATE_TIME_SUFFIX, &Asset::createTime, true },
+    { MODIFY_TIME_SUFFIX, &Asset::modifyTime, true },
+    { SIZE_SUFFIX, &Asset::size, true },
+    { HASH_SUFFIX, &Asset::hash, false },
+};
+constexpr size_t HEADER_LEN = ValueCodec::TAG_LEN + sizeof(AssetCodec::VERSION);
+} // namespace
+
+bool AssetCodec::IsAsset(const Bytes &data)
+{
+    return !data.empty() && data[0] == ValueCodec::TAG_ASSET;
+}
+
+Bytes AssetCodec::Encode(const Asset &asset)
+{
+    size_t len = HEADER_LEN + ValueCodec::MAX_VARINT_LEN;
+    for (const auto &field : STRING_FIELDS) {
+        len += ValueCodec::MAX_VARINT_LEN + (asset.*field.member).size();
+    }
+    Bytes data;
+    data.reserve(len);
+    data.push_back(ValueCodec::TAG_ASSET);
+    data.push_back(VERSION);
+    ValueCodec::PutVarint(asset.status, data);
+    for (const auto &field : STRING_FIELDS) {
+        const std::string &value = asset.*field.member;
+        ValueCodec::PutVarint(value.size(), data);
+        data.insert(data.end(), value.begin(), value.end());
+    }
+    return data;
+}
+
+uint32_t AssetCodec::Decode(const Bytes &data, Asset &asset)
+{
+    if (data.size() < HEADER_LEN || !IsAsset(data) || data[ValueCodec::TAG_LEN] == 0) {
+        LOG_ERROR("not an asset record, size:%{public}zu", data.size());
+        return ERR_DATA_LEN;
+    }
+    const uint8_t *src = data.data() + HEADER_LEN;
+    const uint8_t *end = data.data() + data.size();
+    uint64_t status = 0;
+    if (!ValueCodec::GetVarint(src, end, status) || status > std::numeric_limits<uint32_t>::max()) {
+        LOG_ERROR("bad asset status, size:%{public}zu", data.size());
+        return ERR_DATA_LEN;
+    }
+    Asset result;
+    result.status = static_cast<uint32_t>(status);
+    for (const auto &field : STRING_FIELDS) {
+        uint64_t len = 0;
+        if (!ValueCodec::GetVarint(src, end, len) || len > static_cast<uint64_t>(end - src)) {
+            LOG_ERROR("truncated asset record, size:%{public}zu", data.size());
+            return ERR_DATA_LEN;
+        }
+        (result.*field.member).assign(reinterpret_cast<const char *>(src), len);
+        src += len;
+    }
+    asset = std::move(result);
+    return SUCCESS;
+}
+
+std::vector<std::string> AssetCodec::GetFieldKeys(const std::string &assetKey)
+{
+    std::vector<std::string> keys;
+    keys.reserve(std::size(STRING_FIELDS) + 1);
+    for (const auto &field : STRING_FIELDS) {
+        keys.push_back(assetKey + field.suffix);
+    }
+    keys.push_back(assetKey + STATUS_SUFFIX);
+    return keys;
+}
+
+void AssetCodec::ToFields(
+    const std::string &assetKey, const Asset &asset, std::map<std::string, FieldValue> &fields)
+{
+    for (const auto &field : STRING_FIELDS) {
+        fields.insert_or_assign(assetKey + field.suffix, STRING_PREFIX + asset.*field.member);
+    }
+    fields.insert_or_assign(assetKey + STATUS_SUFFIX, static_cast<double>(asset.status));
+}
+
+bool AssetCodec::FromFields(
+    const std::string &assetKey, const std::map<std::string, FieldValue> &fields, Asset &asset)
+{
+    Asset result;
+    for (const auto &field : STRING_FIELDS) {
+        if (!GetString(fields, assetKey + field.suffix, result.*field.member) && field.required) {
+            return false;
+        }
+    }
+    auto status = fields.find(assetKey + STATUS_SUFFIX);
+    if (status != fields.end() && std::holds_alternative<double>(status->second)) {
+        result.status = static_cast<uint32_t>(std::get<double>(status->second));
+    }
+    asset = std::move(result);
+    return true;
+}
+
+std::vector<std::string> AssetCodec::GetCheckKeys(const std::string &assetKey)
+{
+    return { assetKey + MODIFY_TIME_SUFFIX, assetKey + SIZE_SUFFIX };
+}
+
+bool AssetCodec::MatchesFields(
+    const std::string &assetKey, const std::map<std::string, FieldValue> &fields, const Asset &record)
+{
+    std::string modifyTime;
+    std::string size;
+    return GetString(fields, assetKey + MODIFY_TIME_SUFFIX, modifyTime) && modifyTime == record.modifyTime &&
+        GetString(fields, assetKey + SIZE_SUFFIX, size) && size == record.size;
+}
+
+bool AssetCodec::GetString(
+    const std::map<std::string, FieldValue> &fields, const std::string &key, std::string &value)
+{
+    auto it = fields.find(key);
+    if (it == fields.end() || !std::holds_alternative<std::string>(it->second)) {
+        return false;
+    }
+    const auto &stored = std::get<std::string>(it->second);
+    size_t offset = stored.compare(0, STRING_PREFIX_LEN, STRING_PREFIX) == 0 ? STRING_PREFIX_LEN : 0;
+    value.assign(stored, offset, std::string::npos);
+    return true;
+}
+} // namespace OHOS::ObjectStore
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asset_record_tracker.h"
+
+#include <string_view>
+
+#include "bytes.h"
+#include "object_types.h"
+
+namespace OHOS::ObjectStore {
+namespace {
+constexpr std::string_view RECORD_PREFIX(RECORDS_PREFIX, RECORDS_PREFIX_LEN);
+constexpr std::string_view RECORD(ASSET_RECORD_SUFFIX);
+} // namespace
+
+void AssetRecordTracker::OnChanged(const std::string &sessionId, const std::vector<std::string> &keys)
+{
+    std::set<std::string> withRecord;
+    std::set<std::string> withoutRecord;
+    for (std::string_view key : keys) {
+        bool isRecord = key.compare(0, RECORD_PREFIX.size(), RECORD_PREFIX) == 0;
+        if (!isRecord && !IsFieldKey(key)) {
+            continue;
+        }
+        key.remove_prefix(isRecord ? RECORDS_PREFIX_LEN : FIELDS_PREFIX_LEN);
+        auto dotPos = key.find(*ASSET_DOT);
+        if (dotPos == std::string_view::npos || dotPos == 0 || (isRecord && key.substr(dotPos) != RECORD)) {
+            continue;
+        }
+        auto &assets = isRecord ? withRecord : withoutRecord;
+        assets.emplace(key.substr(0, dotPos));
+    }
+    if (withRecord.empty() && withoutRecord.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &trusted = trusted_[sessionId];
+    for (const auto &assetKey : withoutRecord) {
+        if (withRecord.count(assetKey) == 0) {
+            trusted.erase(assetKey);
+        }
+    }
+    trusted.insert(withRecord.begin(), withRecord.end());
+    if (trusted.empty()) {
+        trusted_.erase(sessionId);
+    }
+}
+
+bool AssetRecordTracker::IsTrusted(const std::string &sessionId, const std::string &assetKey)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = trusted_.find(sessionId);
+    return session != trusted_.end() && session->second.count(assetKey) != 0;
+}
+
+void AssetRecordTracker::Clear(const std::string &sessionId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    trusted_.erase(sessionId);
+}
+} // namespace OHOS::ObjectStore
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "changed_keys.h"
+
+#include <algorithm>
+
+#include "bytes.h"
+#include "object_types.h"
+
+namespace OHOS::ObjectStore {
+namespace {
+constexpr std::string_view FIELD_PREFIX(FIELDS_PREFIX, FIELDS_PREFIX_LEN);
+constexpr std::string_view MODIFY_TIME(MODIFY_TIME_SUFFIX);
+constexpr std::string_view ASSET_SIZE(SIZE_SUFFIX);
+} // namespace
+
+void ChangedKeys::Clear()
+{
+    all_.clear();
+    fields_.clear();
+    assets_.clear();
+    hasDeviceId_ = false;
+    hasSchemaRecord_ = false;
+}
+
+void ChangedKeys::Reserve(size_t count)
+{
+    all_.reserve(count);
+    fields_.reserve(count);
+}
+
+void ChangedKeys::AddStoredKey(std::string_view storedKey)
+{
+    if (storedKey.compare(0, FIELD_PREFIX.size(), FIELD_PREFIX) != 0) {
+        hasSchemaRecord_ = hasSchemaRecord_ || storedKey == SCHEMA_RECORD_KEY;
+        return;
+    }
+    AddField(storedKey.substr(FIELD_PREFIX.size()));
+}
+
+void ChangedKeys::AddField(std::string_view field)
+{
+    all_.push_back(field);
+    auto dotPos = field.find(*ASSET_DOT);
+    if (dotPos == std::string_view::npos) {
+        if (field == DEVICEID_KEY) {
+            hasDeviceId_ = true;
+        } else {
+            fields_.push_back(field);
+        }
+        return;
+    }
+    // Only a new modify time or size means the asset itself changed, other sub-fields follow them.
+    auto suffix = field.substr(dotPos);
+    if ((suffix == MODIFY_TIME && field.size() > MODIFY_TIME.size()) ||
+        (suffix == ASSET_SIZE && field.size() > ASSET_SIZE.size())) {
+        assets_.push_back(field.substr(0, dotPos));
+    }
+}
+
+void ChangedKeys::Finish()
+{
+    if (assets_.size() > 1) {
+        std::sort(assets_.begin(), assets_.end());
+        assets_.erase(std::unique(assets_.begin(), assets_.end()), assets_.end());
+    }
+}
+
+const std::vector<std::string_view> &ChangedKeys::GetAll() const
+{
+    return all_;
+}
+
+const std::vector<std::string_view> &ChangedKeys::GetFields() const
+{
+    return fields_;
+}
+
+const std::vector<std::string_view> &ChangedKeys::GetAssets() const
+{
+    return assets_;
+}
+
+bool ChangedKeys::HasDeviceId() const
+{
+    return hasDeviceId_;
+}
+
+bool ChangedKeys::HasSchemaRecord() const
+{
+    return hasSchemaRecord_;
+}
+
+bool ChangedKeys::Empty() const
+{
+    return all_.empty() && !hasSchemaRecord_;
+}
+} // namespace OHOS::ObjectStore
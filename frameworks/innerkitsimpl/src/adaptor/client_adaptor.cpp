@@ -27,6 +27,9 @@ namespace OHOS::ObjectStore {
 constexpr int32_t DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID = 1301;
 std::shared_ptr<ObjectStoreDataServiceProxy> ClientAdaptor::distributedDataMgr_ = nullptr;
 std::mutex ClientAdaptor::mutex_;
+std::shared_ptr<sptr<OHOS::DistributedObject::IObjectService>> ClientAdaptor::objectService_ = nullptr;
+uint64_t ClientAdaptor::serviceGeneration_ = 0;
+std::atomic<uint64_t> ClientAdaptor::lookupCount_ = 0;
 
 using KvStoreCode = OHOS::DistributedObject::ObjectStoreService::KvStoreServiceInterfaceCode;
 
@@ -41,21 +44,42 @@ public:
 
 sptr<OHOS::DistributedObject::IObjectService> ClientAdaptor::GetObjectService()
 {
-    std::lock_guard<decltype(mutex_)> lockGuard(mutex_);
-    if (distributedDataMgr_ == nullptr) {
-        distributedDataMgr_ = GetDistributedDataManager();
+    auto cached = std::atomic_load(&objectService_);
+    if (cached != nullptr) {
+        return *cached;
+    }
+    std::shared_ptr<ObjectStoreDataServiceProxy> manager;
+    uint64_t generation = 0;
+    {
+        std::lock_guard<decltype(mutex_)> lockGuard(mutex_);
+        if (distributedDataMgr_ == nullptr) {
+            distributedDataMgr_ = GetDistributedDataManager();
+        }
+        manager = distributedDataMgr_;
+        generation = serviceGeneration_;
     }
-    if (distributedDataMgr_ == nullptr) {
+    if (manager == nullptr) {
         LOG_ERROR("get distributed data manager failed");
         return nullptr;
     }
 
-    auto remote = distributedDataMgr_->GetFeatureInterface("data_object");
+    lookupCount_++;
+    auto remote = manager->GetFeatureInterface("data_object");
     if (remote == nullptr) {
         LOG_ERROR("get object service failed");
         return nullptr;
     }
-    return iface_cast<DistributedObject::IObjectService>(remote);
+    auto service = iface_cast<DistributedObject::IObjectService>(remote);
+    std::lock_guard<decltype(mutex_)> lockGuard(mutex_);
+    if (service != nullptr && generation == serviceGeneration_) {
+        std::atomic_store(&objectService_, std::make_shared<sptr<DistributedObject::IObjectService>>(service));
+    }
+    return service;
+}
+
+uint64_t ClientAdaptor::GetLookupCount()
+{
+    return lookupCount_.load();
 }
 
 std::shared_ptr<ObjectStoreDataServiceProxy> ClientAdaptor::GetDistributedDataManager()
@@ -114,6 +138,8 @@ void ClientAdaptor::ServiceDeathRecipient::OnRemoteDied(const wptr<IRemoteObject
     LOG_WARN("DistributedDataService die!");
     std::lock_guard<decltype(mutex_)> lockGuard(mutex_);
     distributedDataMgr_ = nullptr;
+    serviceGeneration_++;
+    std::atomic_store(&objectService_, std::shared_ptr<sptr<DistributedObject::IObjectService>>());
 }
 
 uint32_t ClientAdaptor::RegisterClientDeathListener(const std::string &appId, sptr<IRemoteObject> remoteObject)
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dirty_key_tracker.h"
+
+namespace OHOS::ObjectStore {
+void DirtyKeyTracker::MarkDirty(const std::string &sessionId, const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = baselines_.find(sessionId);
+    if (session == baselines_.end()) {
+        return;
+    }
+    for (auto &[deviceId, keys] : session->second) {
+        keys.insert(key);
+    }
+}
+
+void DirtyKeyTracker::MarkDirty(const std::string &sessionId, const std::vector<std::string> &keys)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = baselines_.find(sessionId);
+    if (session == baselines_.end()) {
+        return;
+    }
+    for (auto &[deviceId, dirtyKeys] : session->second) {
+        dirtyKeys.insert(keys.begin(), keys.end());
+    }
+}
+
+bool DirtyKeyTracker::Take(const std::string &sessionId, const std::string &deviceId, std::set<std::string> &keys)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = baselines_.find(sessionId);
+    if (session == baselines_.end()) {
+        return false;
+    }
+    auto device = session->second.find(deviceId);
+    if (device == session->second.end()) {
+        return false;
+    }
+    keys = std::move(device->second);
+    device->second.clear();
+    return true;
+}
+
+void DirtyKeyTracker::Restore(
+    const std::string &sessionId, const std::string &deviceId, const std::set<std::string> &keys)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = baselines_.find(sessionId);
+    if (session == baselines_.end()) {
+        return;
+    }
+    auto device = session->second.find(deviceId);
+    if (device != session->second.end()) {
+        device->second.insert(keys.begin(), keys.end());
+    }
+}
+
+void DirtyKeyTracker::ResetBaseline(const std::string &sessionId, const std::string &deviceId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    baselines_[sessionId][deviceId].clear();
+}
+
+void DirtyKeyTracker::DropBaseline(const std::string &sessionId, const std::string &deviceId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = baselines_.find(sessionId);
+    if (session == baselines_.end()) {
+        return;
+    }
+    session->second.erase(deviceId);
+    if (session->second.empty()) {
+        baselines_.erase(session);
+    }
+}
+
+void DirtyKeyTracker::DropBaseline(const std::string &sessionId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    baselines_.erase(sessionId);
+}
+} // namespace OHOS::ObjectStore
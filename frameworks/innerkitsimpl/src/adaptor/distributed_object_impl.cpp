@@ -15,10 +15,11 @@
 
 #include "distributed_object_impl.h"
 
+#include <algorithm>
+
 #include "hitrace.h"
 #include "objectstore_errors.h"
 #include "dev_manager.h"
-#include "bytes_utils.h"
 
 namespace OHOS::ObjectStore {
 DistributedObjectImpl::~DistributedObjectImpl()
@@ -74,6 +75,9 @@ std::string &DistributedObjectImpl::GetSessionId()
 DistributedObjectImpl::DistributedObjectImpl(const std::string &sessionId, FlatObjectStore *flatObjectStore)
     : sessionId_(sessionId), flatObjectStore_(flatObjectStore)
 {
+    if (flatObjectStore_ != nullptr) {
+        deviceIdHandle_ = flatObjectStore_->GetPropertyHandle(DEVICEID_KEY);
+    }
 }
 
 uint32_t DistributedObjectImpl::PutComplex(const std::string &key, const std::vector<uint8_t> &value)
@@ -87,6 +91,64 @@ uint32_t DistributedObjectImpl::GetComplex(const std::string &key, std::vector<u
     return flatObjectStore_->GetComplex(sessionId_, key, value);
 }
 
+uint32_t DistributedObjectImpl::GetView(const std::string &key, ValueView &value)
+{
+    return flatObjectStore_->GetView(sessionId_, key, value);
+}
+
+uint32_t DistributedObjectImpl::PutView(const std::string &key, const ValueView &value)
+{
+    DataObjectHiTrace trace("DistributedObjectImpl::PutView");
+    if (value.type == TYPE_STRING && key.find(ASSET_DOT) != std::string::npos) {
+        PutDeviceId();
+    }
+    return flatObjectStore_->PutView(sessionId_, key, value);
+}
+
+uint32_t DistributedObjectImpl::Get(const std::string &key, FieldValue &value)
+{
+    return flatObjectStore_->GetValue(sessionId_, key, value);
+}
+
+uint32_t DistributedObjectImpl::PutBatch(const std::map<std::string, FieldValue> &values)
+{
+    DataObjectHiTrace trace("DistributedObjectImpl::PutBatch");
+    bool hasAssetField = values.size() <= MAX_BATCH_SIZE && values.count(DEVICEID_KEY) == 0 &&
+        std::any_of(values.begin(), values.end(), [](const auto &item) {
+            return std::holds_alternative<std::string>(item.second) && item.first.find(ASSET_DOT) != std::string::npos;
+        });
+    uint32_t status = SUCCESS;
+    if (!hasAssetField) {
+        status = flatObjectStore_->PutBatch(sessionId_, values);
+    } else if (values.size() < MAX_BATCH_SIZE) {
+        // The device id goes in the same transaction, so peers never see the asset sub-fields without it.
+        std::map<std::string, FieldValue> withDeviceId = values;
+        withDeviceId.insert_or_assign(DEVICEID_KEY, DevManager::GetInstance()->GetLocalDevice().networkId);
+        status = flatObjectStore_->PutBatch(sessionId_, withDeviceId);
+    } else {
+        // A full batch has no room left for it.
+        PutDeviceId();
+        status = flatObjectStore_->PutBatch(sessionId_, values);
+    }
+    if (status != SUCCESS) {
+        LOG_ERROR("DistributedObjectImpl:PutBatch failed. status = %{public}d", status);
+    }
+    return status;
+}
+
+uint32_t DistributedObjectImpl::GetBatch(
+    const std::vector<std::string> &keys, std::map<std::string, FieldValue> &values)
+{
+    DataObjectHiTrace trace("DistributedObjectImpl::GetBatch");
+    return flatObjectStore_->GetBatch(sessionId_, keys, values);
+}
+
+uint32_t DistributedObjectImpl::GetAll(std::map<std::string, FieldValue> &values)
+{
+    DataObjectHiTrace trace("DistributedObjectImpl::GetAll");
+    return flatObjectStore_->GetAll(sessionId_, values);
+}
+
 uint32_t DistributedObjectImpl::Save(const std::string &deviceId)
 {
     uint32_t status = flatObjectStore_->Save(sessionId_, deviceId);
@@ -107,44 +169,128 @@ uint32_t DistributedObjectImpl::RevokeSave()
     return status;
 }
 
+uint32_t DistributedObjectImpl::SaveAsync(
+    const std::string &deviceId, uint32_t timeout, const SaveCallback &callback, SaveId &saveId)
+{
+    uint32_t status = flatObjectStore_->SaveAsync(sessionId_, deviceId, timeout, callback, saveId);
+    if (status != SUCCESS) {
+        LOG_ERROR("DistributedObjectImpl:SaveAsync failed. status = %{public}d", status);
+    }
+    return status;
+}
+
+uint32_t DistributedObjectImpl::RevokeSaveAsync(uint32_t timeout, const SaveCallback &callback, SaveId &saveId)
+{
+    uint32_t status = flatObjectStore_->RevokeSaveAsync(sessionId_, timeout, callback, saveId);
+    if (status != SUCCESS) {
+        LOG_ERROR("DistributedObjectImpl:RevokeSaveAsync failed. status = %{public}d", status);
+    }
+    return status;
+}
+
+bool DistributedObjectImpl::CancelSave(SaveId saveId)
+{
+    return flatObjectStore_->CancelSave(saveId);
+}
+
+uint32_t DistributedObjectImpl::SetSyncPolicy(SyncPolicy policy, uint32_t window)
+{
+    return flatObjectStore_->SetSyncPolicy(sessionId_, policy, window);
+}
+
+uint32_t DistributedObjectImpl::Commit()
+{
+    uint32_t status = flatObjectStore_->Commit(sessionId_);
+    if (status != SUCCESS) {
+        LOG_ERROR("DistributedObjectImpl:Commit failed. status = %{public}d", status);
+    }
+    return status;
+}
+
+uint32_t DistributedObjectImpl::GetSyncStats(SyncStats &stats)
+{
+    return flatObjectStore_->GetSyncStats(sessionId_, stats);
+}
+
+uint32_t DistributedObjectImpl::GetVersion(uint64_t &version)
+{
+    return flatObjectStore_->GetVersion(sessionId_, version);
+}
+
 uint32_t DistributedObjectImpl::PutDeviceId()
 {
     DevManager::DetailInfo detailInfo = DevManager::GetInstance()->GetLocalDevice();
-    return flatObjectStore_->PutString(sessionId_, DEVICEID_KEY, detailInfo.networkId);
+    return flatObjectStore_->Put(sessionId_, deviceIdHandle_, std::move(detailInfo.networkId));
 }
 
 uint32_t DistributedObjectImpl::GetAssetValue(const std::string &assetKey, Asset &assetValue)
 {
-    double assetStatus = 0.0;
-    auto status = GetDouble(assetKey + STATUS_SUFFIX, assetStatus);
-    if (status == SUCCESS) {
-        assetValue.status = static_cast<uint32_t>(assetStatus);
+    auto status = GetAsset(assetKey, assetValue);
+    LOG_ERROR_RETURN(status == SUCCESS, "get asset failed!", status);
+    assetValue.hash = assetValue.modifyTime + "_" + assetValue.size;
+    return status;
+}
+
+uint32_t DistributedObjectImpl::PutAsset(const std::string &assetKey, const Asset &asset)
+{
+    DataObjectHiTrace trace("DistributedObjectImpl::PutAsset");
+    DevManager::DetailInfo detailInfo = DevManager::GetInstance()->GetLocalDevice();
+    uint32_t status = flatObjectStore_->PutAsset(sessionId_, assetKey, asset, detailInfo.networkId);
+    if (status != SUCCESS) {
+        LOG_ERROR("DistributedObjectImpl:PutAsset failed. status = %{public}d", status);
     }
-    status = GetString(assetKey + NAME_SUFFIX, assetValue.name);
-    LOG_ERROR_RETURN(status == SUCCESS, "get name failed!", status);
-    status = GetString(assetKey + URI_SUFFIX, assetValue.uri);
-    LOG_ERROR_RETURN(status == SUCCESS, "get uri failed!", status);
-    status = GetString(assetKey + PATH_SUFFIX, assetValue.path);
-    LOG_ERROR_RETURN(status == SUCCESS, "get path failed!", status);
-    status = GetString(assetKey + CREATE_TIME_SUFFIX, assetValue.createTime);
-    LOG_ERROR_RETURN(status == SUCCESS, "get createTime failed!", status);
-    status = GetString(assetKey + MODIFY_TIME_SUFFIX, assetValue.modifyTime);
-    LOG_ERROR_RETURN(status == SUCCESS, "get modifyTime failed!", status);
-    status = GetString(assetKey + SIZE_SUFFIX, assetValue.size);
-    LOG_ERROR_RETURN(status == SUCCESS, "get size failed!", status);
-    RemovePrefix(assetValue);
     return status;
 }
 
-void DistributedObjectImpl::RemovePrefix(Asset &assetValue)
+uint32_t DistributedObjectImpl::GetAsset(const std::string &assetKey, Asset &asset)
 {
-    assetValue.name = assetValue.name.substr(STRING_PREFIX_LEN);
-    assetValue.uri = assetValue.uri.substr(STRING_PREFIX_LEN);
-    assetValue.path = assetValue.path.substr(STRING_PREFIX_LEN);
-    assetValue.createTime = assetValue.createTime.substr(STRING_PREFIX_LEN);
-    assetValue.modifyTime = assetValue.modifyTime.substr(STRING_PREFIX_LEN);
-    assetValue.size = assetValue.size.substr(STRING_PREFIX_LEN);
-    assetValue.hash = assetValue.modifyTime + "_" + assetValue.size;
+    DataObjectHiTrace trace("DistributedObjectImpl::GetAsset");
+    return flatObjectStore_->GetAsset(sessionId_, assetKey, asset);
+}
+
+PropertyHandle DistributedObjectImpl::GetPropertyHandle(const std::string &key)
+{
+    return flatObjectStore_->GetPropertyHandle(key);
+}
+
+uint32_t DistributedObjectImpl::Put(const PropertyHandle &handle, const FieldValue &value)
+{
+    DataObjectHiTrace trace("DistributedObjectImpl::Put");
+    if (handle != nullptr && handle->isAssetField && std::holds_alternative<std::string>(value)) {
+        PutDeviceId();
+    }
+    return flatObjectStore_->Put(sessionId_, handle, value);
+}
+
+uint32_t DistributedObjectImpl::Get(const PropertyHandle &handle, FieldValue &value)
+{
+    return flatObjectStore_->Get(sessionId_, handle, value);
+}
+
+uint32_t DistributedObjectImpl::GetView(const PropertyHandle &handle, ValueView &value)
+{
+    return flatObjectStore_->GetView(sessionId_, handle, value);
+}
+
+uint32_t DistributedObjectImpl::BindSchema(const ObjectSchema &schema)
+{
+    return flatObjectStore_->BindSchema(sessionId_, schema);
+}
+
+uint32_t DistributedObjectImpl::PutRecord(const SchemaRecord &record)
+{
+    DataObjectHiTrace trace("DistributedObjectImpl::PutRecord");
+    uint32_t status = flatObjectStore_->PutRecord(sessionId_, record);
+    if (status != SUCCESS) {
+        LOG_ERROR("DistributedObjectImpl:PutRecord failed. status = %{public}d", status);
+    }
+    return status;
+}
+
+uint32_t DistributedObjectImpl::GetRecord(SchemaRecord &record)
+{
+    DataObjectHiTrace trace("DistributedObjectImpl::GetRecord");
+    return flatObjectStore_->GetRecord(sessionId_, record);
 }
 
 uint32_t DistributedObjectImpl::BindAssetStore(const std::string &assetKey, AssetBindInfo &bindInfo)
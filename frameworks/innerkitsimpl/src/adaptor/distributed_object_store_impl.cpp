@@ -13,8 +13,6 @@
  * limitations under the License.
  */
 
-#include <unordered_set>
-
 #include "hitrace.h"
 #include "distributed_object_impl.h"
 #include "distributed_objectstore_impl.h"
@@ -42,23 +40,22 @@ DistributedObject *DistributedObjectStoreImpl::CacheObject(
         return nullptr;
     }
     std::unique_lock<std::shared_mutex> cacheLock(dataMutex_);
-    objects_.push_back(object);
-    return object;
+    auto [iter, inserted] = objects_.emplace(sessionId, object);
+    if (!inserted) {
+        // Created again, the object handed out before stays the one of this session.
+        delete object;
+    }
+    return iter->second;
 }
 
 void DistributedObjectStoreImpl::RemoveCacheObject(const std::string &sessionId)
 {
     std::unique_lock<std::shared_mutex> cacheLock(dataMutex_);
-    auto iter = objects_.begin();
-    while (iter != objects_.end()) {
-        if ((*iter)->GetSessionId() == sessionId) {
-            delete *iter;
-            iter = objects_.erase(iter);
-        } else {
-            iter++;
-        }
+    auto iter = objects_.find(sessionId);
+    if (iter != objects_.end()) {
+        delete iter->second;
+        objects_.erase(iter);
     }
-    return;
 }
 
 DistributedObject *DistributedObjectStoreImpl::CreateObject(const std::string &sessionId)
@@ -105,6 +102,69 @@ DistributedObject *DistributedObjectStoreImpl::CreateObject(const std::string &s
     return CacheObject(sessionId, flatObjectStore_);
 }
 
+DistributedObject *DistributedObjectStoreImpl::CreateObject(
+    const std::string &sessionId, StorageType storageType, uint32_t &status)
+{
+    DataObjectHiTrace trace("DistributedObjectStoreImpl::CreateObject");
+    if (flatObjectStore_ == nullptr) {
+        LOG_ERROR("DistributedObjectStoreImpl::CreateObject store not opened!");
+        status = ERR_NULL_OBJECTSTORE;
+        return nullptr;
+    }
+
+    if (sessionId.empty() || storageType > STORAGE_MEMORY) {
+        LOG_ERROR("DistributedObjectStoreImpl::CreateObject Invalid args, storageType:%{public}d", storageType);
+        status = ERR_INVALID_ARGS;
+        return nullptr;
+    }
+
+    status = flatObjectStore_->CreateObject(sessionId, storageType);
+    if (status != SUCCESS) {
+        LOG_ERROR("DistributedObjectStoreImpl::CreateObject CreateTable err %{public}d", status);
+        return nullptr;
+    }
+    return CacheObject(sessionId, flatObjectStore_);
+}
+
+void DistributedObjectStoreImpl::CreateObjectAsync(const std::string &sessionId, const CreateCallback &callback)
+{
+    if (callback == nullptr) {
+        LOG_ERROR("DistributedObjectStoreImpl::CreateObjectAsync callback is null");
+        return;
+    }
+    if (flatObjectStore_ == nullptr) {
+        LOG_ERROR("DistributedObjectStoreImpl::CreateObjectAsync store not opened!");
+        callback(nullptr, ERR_NULL_OBJECTSTORE);
+        return;
+    }
+    if (sessionId.empty()) {
+        LOG_ERROR("DistributedObjectStoreImpl::CreateObjectAsync Invalid sessionId");
+        callback(nullptr, ERR_INVALID_ARGS);
+        return;
+    }
+    flatObjectStore_->CreateObjectAsync(sessionId, [this, sessionId, callback](uint32_t status) {
+        if (status != SUCCESS) {
+            LOG_ERROR("DistributedObjectStoreImpl::CreateObjectAsync CreateTable err %{public}d", status);
+            callback(nullptr, status);
+            return;
+        }
+        callback(CacheObject(sessionId, flatObjectStore_), SUCCESS);
+    });
+}
+
+uint32_t DistributedObjectStoreImpl::PrepareObject(const std::string &sessionId)
+{
+    if (flatObjectStore_ == nullptr) {
+        LOG_ERROR("DistributedObjectStoreImpl::PrepareObject store not opened!");
+        return ERR_NULL_OBJECTSTORE;
+    }
+    if (sessionId.empty()) {
+        LOG_ERROR("DistributedObjectStoreImpl::PrepareObject Invalid sessionId");
+        return ERR_INVALID_ARGS;
+    }
+    return flatObjectStore_->PrepareObject(sessionId);
+}
+
 uint32_t DistributedObjectStoreImpl::DeleteObject(const std::string &sessionId)
 {
     DataObjectHiTrace trace("DistributedObjectStoreImpl::DeleteObject");
@@ -123,14 +183,11 @@ uint32_t DistributedObjectStoreImpl::DeleteObject(const std::string &sessionId)
 
 uint32_t DistributedObjectStoreImpl::Get(const std::string &sessionId, DistributedObject **object)
 {
-    std::unique_lock<std::shared_mutex> cacheLock(dataMutex_);
-    auto iter = objects_.begin();
-    while (iter != objects_.end()) {
-        if ((*iter)->GetSessionId() == sessionId) {
-            *object = *iter;
-            return SUCCESS;
-        }
-        iter++;
+    std::shared_lock<std::shared_mutex> cacheLock(dataMutex_);
+    auto iter = objects_.find(sessionId);
+    if (iter != objects_.end()) {
+        *object = iter->second;
+        return SUCCESS;
     }
     LOG_ERROR("DistributedObjectStoreImpl::Get object err, no object");
     return ERR_GET_OBJECT;
@@ -218,6 +275,15 @@ void DistributedObjectStoreImpl::NotifyProgressStatus(const std::string &session
     flatObjectStore_->CheckProgressCache(sessionId);
 }
 
+void DistributedObjectStoreImpl::SetCompressThreshold(size_t threshold)
+{
+    if (flatObjectStore_ == nullptr) {
+        LOG_ERROR("flatObjectStore_ is nullptr");
+        return;
+    }
+    flatObjectStore_->SetCompressThreshold(threshold);
+}
+
 WatcherProxy::WatcherProxy(const std::shared_ptr<ObjectWatcher> objectWatcher, const std::string &sessionId)
     : FlatObjectWatcher(sessionId), objectWatcher_(objectWatcher)
 {
@@ -226,41 +292,35 @@ WatcherProxy::WatcherProxy(const std::shared_ptr<ObjectWatcher> objectWatcher, c
 void WatcherProxy::OnChanged(
     const std::string &sessionId, const std::vector<std::string> &changedData, bool enableTransfer)
 {
-    std::unordered_set<std::string> transferKeys;
-    std::vector<std::string> otherKeys;
-    for (const auto &str : changedData) {
-        if (str.find(ASSET_DOT) == std::string::npos) {
-            if (str != DEVICEID_KEY) {
-                otherKeys.push_back(str);
-            }
-        } else {
-            std::string assetKey;
-            if (FindChangedAssetKey(str, assetKey)) {
-                transferKeys.insert(assetKey);
-            }
+    ChangedKeys changedKeys;
+    changedKeys.Reserve(changedData.size());
+    for (const auto &key : changedData) {
+        changedKeys.AddField(key);
+    }
+    changedKeys.Finish();
+    OnChangedKeys(sessionId, changedKeys, enableTransfer);
+}
+
+void WatcherProxy::OnChangedKeys(const std::string &sessionId, const ChangedKeys &changedKeys, bool enableTransfer)
+{
+    const auto &fields = changedKeys.GetFields();
+    const auto &assets = changedKeys.GetAssets();
+    if (enableTransfer && assetChangeCallback_ != nullptr) {
+        for (const auto &assetKey : assets) {
+            assetChangeCallback_(sessionId, std::string(assetKey), objectWatcher_);
         }
     }
+    // Keys are only copied here, at the boundary of the public watcher interface.
+    std::vector<std::string> otherKeys(fields.begin(), fields.end());
     if (!enableTransfer) {
-        otherKeys.insert(otherKeys.end(), transferKeys.begin(), transferKeys.end());
-    } else if (assetChangeCallback_ != nullptr && !transferKeys.empty()) {
-        for (auto &assetKey : transferKeys) {
-            assetChangeCallback_(sessionId, assetKey, objectWatcher_);
-        }
+        otherKeys.insert(otherKeys.end(), assets.begin(), assets.end());
     }
     if (!otherKeys.empty()) {
         objectWatcher_->OnChanged(sessionId, otherKeys);
     }
-}
-
-bool WatcherProxy::FindChangedAssetKey(const std::string &changedKey, std::string &assetKey)
-{
-    std::size_t dotPos = changedKey.find(ASSET_DOT);
-    if ((changedKey.size() > strlen(MODIFY_TIME_SUFFIX) && changedKey.substr(dotPos) == MODIFY_TIME_SUFFIX) ||
-            (changedKey.size() > strlen(SIZE_SUFFIX) && changedKey.substr(dotPos) == SIZE_SUFFIX)) {
-        assetKey = changedKey.substr(0, dotPos);
-        return true;
+    if (changedKeys.HasSchemaRecord()) {
+        objectWatcher_->OnRecordChanged(sessionId);
     }
-    return false;
 }
 
 void WatcherProxy::SetAssetChangeCallBack(const AssetChangeCallback &assetChangeCallback)
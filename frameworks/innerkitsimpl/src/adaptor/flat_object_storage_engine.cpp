@@ -14,6 +14,8 @@
  */
 #include "flat_object_storage_engine.h"
 
+#include <cinttypes>
+
 #include "anonymous.h"
 #include "accesstoken_kit.h"
 #include "ipc_skeleton.h"
@@ -29,6 +31,13 @@ FlatObjectStorageEngine::~FlatObjectStorageEngine()
     if (!isOpened_) {
         return;
     }
+    for (auto &[key, session] : GetSessions()) {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        FlushLocked(key, *session);
+    }
+    ClosePrepared();
+    executor_ = nullptr;
+    openExecutor_ = nullptr;
     storeManager_ = nullptr;
     LOG_INFO("FlatObjectStorageEngine::~FlatObjectStorageEngine Crash! end");
 }
@@ -68,12 +77,51 @@ uint32_t FlatObjectStorageEngine::Close()
         LOG_INFO("FlatObjectStorageEngine::Close has been closed!");
         return SUCCESS;
     }
-    std::lock_guard<std::mutex> lock(operationMutex_);
+    for (auto &[key, session] : GetSessions()) {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        FlushLocked(key, *session);
+    }
+    ClosePrepared();
+    std::unique_lock<std::shared_mutex> lock(sessionMutex_);
     storeManager_ = nullptr;
     isOpened_ = false;
     return SUCCESS;
 }
 
+std::shared_ptr<FlatObjectStorageEngine::Session> FlatObjectStorageEngine::GetSession(const std::string &key)
+{
+    std::shared_lock<std::shared_mutex> lock(sessionMutex_);
+    auto iter = sessions_.find(key);
+    if (iter == sessions_.end()) {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+std::map<std::string, std::shared_ptr<FlatObjectStorageEngine::Session>> FlatObjectStorageEngine::GetSessions()
+{
+    std::shared_lock<std::shared_mutex> lock(sessionMutex_);
+    return sessions_;
+}
+
+bool FlatObjectStorageEngine::BeginCreate(const std::string &key)
+{
+    std::unique_lock<std::shared_mutex> lock(sessionMutex_);
+    if (sessions_.count(key) != 0) {
+        return false;
+    }
+    return creating_.insert(key).second;
+}
+
+void FlatObjectStorageEngine::EndCreate(const std::string &key, std::shared_ptr<Session> session)
+{
+    std::unique_lock<std::shared_mutex> lock(sessionMutex_);
+    creating_.erase(key);
+    if (session != nullptr) {
+        sessions_.emplace(key, std::move(session));
+    }
+}
+
 void FlatObjectStorageEngine::OnComplete(const std::string &key,
     const std::map<std::string, DistributedDB::DBStatus> &devices, std::shared_ptr<StatusWatcher> statusWatcher)
 {
@@ -95,20 +143,68 @@ uint32_t FlatObjectStorageEngine::CreateTable(const std::string &key)
             RADAR_FAILED, DB_NOT_INIT, FINISHED);
         return ERR_DB_NOT_INIT;
     }
-    {
-        std::lock_guard<std::mutex> lock(operationMutex_);
-        if (delegates_.count(key) != 0) {
-            LOG_ERROR("table: %{public}s already created", Anonymous::Change(key).c_str());
-            RadarReporter::ReportStateError(std::string(__FUNCTION__), CREATE, CREATE_TABLE, RADAR_FAILED,
-                DUPLICATE_CREATE, FINISHED);
-            return ERR_EXIST;
+    // Claimed before the delegate is opened, so a concurrent create neither opens a second one nor replaces the
+    // session, and its buffered writes, once this one is in.
+    if (!BeginCreate(key)) {
+        LOG_ERROR("table: %{public}s already created", Anonymous::Change(key).c_str());
+        RadarReporter::ReportStateError(std::string(__FUNCTION__), CREATE, CREATE_TABLE, RADAR_FAILED,
+            DUPLICATE_CREATE, FINISHED);
+        return ERR_EXIST;
+    }
+    DistributedDB::DBStatus status = DistributedDB::DBStatus::OK;
+    DistributedDB::KvStoreNbDelegate *kvStore = TakePrepared(key, true);
+    if (kvStore == nullptr) {
+        status = OpenDelegate(key, kvStore);
+        if (status != DistributedDB::DBStatus::OK) {
+            EndCreate(key, nullptr);
+            RadarReporter::ReportStateError(std::string(__FUNCTION__), CREATE, CREATE_TABLE,
+                RADAR_FAILED, status, FINISHED);
+            return ERR_DB_GETKV_FAIL;
         }
     }
+    LOG_INFO("create table %{public}s success", Anonymous::Change(key).c_str());
+    auto session = std::make_shared<Session>();
+    session->delegate = kvStore;
+    session->changeObserver = std::make_shared<DataChangeObserver>(key, weak_from_this(), session);
+    keyIndex_.Begin(key);
+    std::vector<uint8_t> observeKey;
+    status = kvStore->RegisterObserver(
+        observeKey, DistributedDB::ObserverMode::OBSERVER_CHANGES_FOREIGN, session->changeObserver);
+    if (status != DistributedDB::DBStatus::OK) {
+        LOG_ERROR("Register change observer fail[%{public}d], store:%{public}s", status,
+            Anonymous::Change(key).c_str());
+        // Without remote change events the index, the snapshots and the value cache of FlatObjectStore would go
+        // stale, so the table is not created.
+        keyIndex_.Drop(key);
+        CloseDelegate(kvStore);
+        EndCreate(key, nullptr);
+        RadarReporter::ReportStateError(std::string(__FUNCTION__), CREATE, CREATE_TABLE,
+            RADAR_FAILED, status, FINISHED);
+        return ERR_REGISTER;
+    }
+    LoadItems(key, kvStore, *session->items);
+    EndCreate(key, session);
+    SyncOnCreate(key);
+    RadarReporter::ReportStateFinished(std::string(__FUNCTION__), CREATE, CREATE_TABLE, RADAR_SUCCESS, FINISHED);
+    return SUCCESS;
+}
+
+DistributedDB::DBStatus FlatObjectStorageEngine::OpenDelegate(
+    const std::string &key, DistributedDB::KvStoreNbDelegate *&delegate)
+{
+    std::shared_ptr<DistributedDB::KvStoreDelegateManager> storeManager;
+    {
+        std::shared_lock<std::shared_mutex> lock(sessionMutex_);
+        storeManager = storeManager_;
+    }
+    if (storeManager == nullptr) {
+        return DistributedDB::DBStatus::DB_ERROR;
+    }
     DistributedDB::KvStoreNbDelegate *kvStore = nullptr;
-    DistributedDB::DBStatus status;
+    DistributedDB::DBStatus status = DistributedDB::DBStatus::DB_ERROR;
     DistributedDB::KvStoreNbDelegate::Option option = { true, true, false };
     LOG_INFO("start create table");
-    storeManager_->GetKvStore(key, option,
+    storeManager->GetKvStore(key, option,
         [&status, &kvStore](DistributedDB::DBStatus dbStatus, DistributedDB::KvStoreNbDelegate *kvStoreNbDelegate) {
             status = dbStatus;
             kvStore = kvStoreNbDelegate;
@@ -116,9 +212,7 @@ uint32_t FlatObjectStorageEngine::CreateTable(const std::string &key)
         });
     if (status != DistributedDB::DBStatus::OK || kvStore == nullptr) {
         LOG_ERROR("GetKvStore fail[%{public}d], store:%{public}s", status, Anonymous::Change(key).c_str());
-        RadarReporter::ReportStateError(std::string(__FUNCTION__), CREATE, CREATE_TABLE,
-            RADAR_FAILED, status, FINISHED);
-        return ERR_DB_GETKV_FAIL;
+        return status == DistributedDB::DBStatus::OK ? DistributedDB::DBStatus::DB_ERROR : status;
     }
     bool autoSync = true;
     DistributedDB::PragmaData data = static_cast<DistributedDB::PragmaData>(&autoSync);
@@ -126,15 +220,50 @@ uint32_t FlatObjectStorageEngine::CreateTable(const std::string &key)
     status = kvStore->Pragma(DistributedDB::AUTO_SYNC, data);
     if (status != DistributedDB::DBStatus::OK) {
         LOG_ERROR("Set Pragma fail[%{public}d], store:%{public}s", status, Anonymous::Change(key).c_str());
-        RadarReporter::ReportStateError(std::string(__FUNCTION__), CREATE, CREATE_TABLE,
-            RADAR_FAILED, status, FINISHED);
-        return ERR_DB_GETKV_FAIL;
+        storeManager->CloseKvStore(kvStore);
+        return status;
     }
-    LOG_INFO("create table %{public}s success", Anonymous::Change(key).c_str());
+    delegate = kvStore;
+    return DistributedDB::DBStatus::OK;
+}
+
+void FlatObjectStorageEngine::CloseDelegate(DistributedDB::KvStoreNbDelegate *delegate)
+{
+    if (delegate == nullptr) {
+        return;
+    }
+    std::shared_ptr<DistributedDB::KvStoreDelegateManager> storeManager;
     {
-        std::lock_guard<std::mutex> lock(operationMutex_);
-        delegates_.insert_or_assign(key, kvStore);
+        std::shared_lock<std::shared_mutex> lock(sessionMutex_);
+        storeManager = storeManager_;
+    }
+    if (storeManager == nullptr) {
+        return;
+    }
+    auto status = storeManager->CloseKvStore(delegate);
+    if (status != DistributedDB::DBStatus::OK) {
+        LOG_ERROR("CloseKvStore fail[%{public}d]", status);
     }
+}
+
+void FlatObjectStorageEngine::SyncOnCreate(const std::string &key)
+{
+    // Listing the devices queries the device manager, the caller creating the table does not wait for it.
+    auto weakEngine = weak_from_this();
+    if (weakEngine.expired()) {
+        SyncAllDevices(key);
+        return;
+    }
+    GetOpenExecutor()->Execute([weakEngine, key]() {
+        auto engine = weakEngine.lock();
+        if (engine != nullptr) {
+            engine->SyncAllDevices(key);
+        }
+    });
+}
+
+void FlatObjectStorageEngine::SyncAllDevices(const std::string &key)
+{
     auto onComplete = [key, this](const std::map<std::string, DistributedDB::DBStatus> &devices) {
         OnComplete(key, devices, statusWatcher_);
     };
@@ -144,53 +273,241 @@ uint32_t FlatObjectStorageEngine::CreateTable(const std::string &key)
         deviceIds.push_back(item.deviceId);
     }
     SyncAllData(key, deviceIds, onComplete);
-    RadarReporter::ReportStateFinished(std::string(__FUNCTION__), CREATE, CREATE_TABLE, RADAR_SUCCESS, FINISHED);
+}
+
+void FlatObjectStorageEngine::SyncOnline(
+    const std::string &key, const std::string &deviceId, const SyncCallback &onComplete)
+{
+    // Changes the device missed while away go out with the pull.
+    auto weakEngine = weak_from_this();
+    if (weakEngine.expired()) {
+        SyncAllData(key, std::vector<std::string>({ deviceId }), onComplete,
+            DistributedDB::SyncMode::SYNC_MODE_PUSH_PULL);
+        return;
+    }
+    // Every store of the process is notified at once, the scheduler keeps them from syncing all together.
+    auto task = [weakEngine, key, deviceId, onComplete](const SyncScheduler::Done &done) -> uint32_t {
+        auto engine = weakEngine.lock();
+        if (engine == nullptr) {
+            return ERR_DB_NOT_INIT;
+        }
+        auto callback = [onComplete, done](const std::map<std::string, DistributedDB::DBStatus> &devices) {
+            bool succeeded = !devices.empty();
+            for (const auto &[device, status] : devices) {
+                succeeded = succeeded && status == DistributedDB::DBStatus::OK;
+            }
+            onComplete(devices);
+            done(succeeded);
+        };
+        return engine->SyncAllData(key, std::vector<std::string>({ deviceId }), callback,
+            DistributedDB::SyncMode::SYNC_MODE_PUSH_PULL);
+    };
+    SyncScheduler::GetInstance()->Submit(key, deviceId, GetSyncPriority(key), task);
+}
+
+SyncScheduler::Priority FlatObjectStorageEngine::GetSyncPriority(const std::string &key)
+{
+    // A watched object is shown by the app, its data is wanted before that of the objects nobody watches.
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        return SyncScheduler::PRIORITY_LOW;
+    }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    return session->observer != nullptr ? SyncScheduler::PRIORITY_HIGH : SyncScheduler::PRIORITY_LOW;
+}
+
+void FlatObjectStorageEngine::CreateTableAsync(
+    const std::string &key, const std::function<void(uint32_t status)> &callback)
+{
+    auto weakEngine = weak_from_this();
+    if (weakEngine.expired()) {
+        uint32_t status = CreateTable(key);
+        if (callback) {
+            callback(status);
+        }
+        return;
+    }
+    GetOpenExecutor()->Execute([weakEngine, key, callback]() {
+        auto engine = weakEngine.lock();
+        uint32_t status = engine == nullptr ? ERR_DB_NOT_INIT : engine->CreateTable(key);
+        if (callback) {
+            callback(status);
+        }
+    });
+}
+
+uint32_t FlatObjectStorageEngine::PrepareTable(const std::string &key)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    if (GetSession(key) != nullptr) {
+        return ERR_EXIST;
+    }
+    {
+        std::lock_guard<std::mutex> lock(preparedMutex_);
+        if (prepared_.find(key) != prepared_.end()) {
+            return SUCCESS;
+        }
+        if (prepared_.size() >= MAX_PREPARED_TABLES) {
+            LOG_ERROR("too many prepared tables, skip %{public}s", Anonymous::Change(key).c_str());
+            return ERR_PROCESSING;
+        }
+        prepared_.emplace(key, PreparedDelegate());
+    }
+    auto weakEngine = weak_from_this();
+    if (weakEngine.expired()) {
+        OpenPrepared(key);
+        return SUCCESS;
+    }
+    GetOpenExecutor()->Execute([weakEngine, key]() {
+        auto engine = weakEngine.lock();
+        if (engine != nullptr) {
+            engine->OpenPrepared(key);
+        }
+    });
     return SUCCESS;
 }
 
+void FlatObjectStorageEngine::OpenPrepared(const std::string &key)
+{
+    DistributedDB::KvStoreNbDelegate *delegate = nullptr;
+    if (OpenDelegate(key, delegate) != DistributedDB::DBStatus::OK) {
+        TakePrepared(key, false);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(preparedMutex_);
+        auto it = prepared_.find(key);
+        // CreateTable has given up on this delegate and opened its own, or the engine was closed.
+        if (it != prepared_.end() && it->second.delegate == nullptr) {
+            it->second.delegate = delegate;
+            auto weakEngine = weak_from_this();
+            if (!weakEngine.expired()) {
+                it->second.expireTask = GetOpenExecutor()->Schedule(std::chrono::milliseconds(PREPARED_TTL),
+                    [weakEngine, key]() {
+                        auto engine = weakEngine.lock();
+                        if (engine != nullptr) {
+                            engine->CloseDelegate(engine->TakePrepared(key, false));
+                        }
+                    });
+            }
+            LOG_INFO("table %{public}s prepared", Anonymous::Change(key).c_str());
+            return;
+        }
+    }
+    CloseDelegate(delegate);
+}
+
+DistributedDB::KvStoreNbDelegate *FlatObjectStorageEngine::TakePrepared(const std::string &key, bool cancelExpire)
+{
+    std::lock_guard<std::mutex> lock(preparedMutex_);
+    auto it = prepared_.find(key);
+    if (it == prepared_.end()) {
+        return nullptr;
+    }
+    auto delegate = it->second.delegate;
+    if (cancelExpire && it->second.expireTask != Executor::INVALID_TASK_ID) {
+        GetOpenExecutor()->Remove(it->second.expireTask);
+    }
+    prepared_.erase(it);
+    return delegate;
+}
+
+void FlatObjectStorageEngine::ClosePrepared()
+{
+    std::map<std::string, PreparedDelegate> prepared;
+    {
+        std::lock_guard<std::mutex> lock(preparedMutex_);
+        prepared = std::move(prepared_);
+        prepared_.clear();
+    }
+    for (auto &[key, item] : prepared) {
+        if (item.expireTask != Executor::INVALID_TASK_ID) {
+            GetOpenExecutor()->Remove(item.expireTask);
+        }
+        CloseDelegate(item.delegate);
+    }
+}
+
 uint32_t FlatObjectStorageEngine::GetTable(const std::string &key, std::map<std::string, Value> &result)
+{
+    result.clear();
+    return ForEachItem(key, [&result](std::string_view itemKey, const Value &value) {
+        result.insert_or_assign(std::string(itemKey), value);
+        return true;
+    });
+}
+
+uint32_t FlatObjectStorageEngine::ForEachItem(const std::string &key, const ItemVisitor &visitor)
 {
     if (!isOpened_) {
-        LOG_ERROR("not opened %{public}s", key.c_str());
+        LOG_ERROR("not opened %{public}s", Anonymous::Change(key).c_str());
         return ERR_DB_NOT_INIT;
     }
-    std::lock_guard<std::mutex> lock(operationMutex_);
-    if (delegates_.count(key) == 0) {
-        LOG_INFO("FlatObjectStorageEngine::GetTable %{public}s not exist", key.c_str());
+    if (visitor == nullptr) {
+        LOG_ERROR("visitor is null %{public}s", Anonymous::Change(key).c_str());
+        return ERR_INVALID_ARGS;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        LOG_INFO("FlatObjectStorageEngine::ForEachItem %{public}s not exist", Anonymous::Change(key).c_str());
         return ERR_DB_NOT_EXIST;
     }
-    result.clear();
+    if (auto snapshot = session->items->Get(); snapshot != nullptr) {
+        snapshot->ForEach(visitor);
+        return SUCCESS;
+    }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->delegate == nullptr) {
+        LOG_INFO("FlatObjectStorageEngine::ForEachItem %{public}s not exist", Anonymous::Change(key).c_str());
+        return ERR_DB_NOT_EXIST;
+    }
+    RetainFlushErrorLocked(*session, FlushLocked(key, *session));
+    // Snapshots the shared budget dropped come back with this scan once they fit again, later reads skip the store.
+    if (session->items->CanReload()) {
+        std::map<std::string, Value> values;
+        if (ReadEntries(session->delegate, values) == DistributedDB::DBStatus::OK &&
+            session->items->Reload(std::move(values))) {
+            LOG_INFO("item snapshots reloaded, store:%{public}s", Anonymous::Change(key).c_str());
+            session->items->Get()->ForEach(visitor);
+            return SUCCESS;
+        }
+    }
     DistributedDB::KvStoreResultSet *resultSet = nullptr;
     Key emptyKey;
-    LOG_DEBUG("start GetEntries");
-    auto delegate = delegates_.at(key);
+    auto delegate = session->delegate;
     DistributedDB::DBStatus status = delegate->GetEntries(emptyKey, resultSet);
+    if (status == DistributedDB::DBStatus::NOT_FOUND) {
+        // An empty table, nothing to visit.
+        return SUCCESS;
+    }
     if (status != DistributedDB::DBStatus::OK || resultSet == nullptr) {
-        LOG_INFO("FlatObjectStorageEngine::GetTable %{public}s GetEntries fail", key.c_str());
+        LOG_INFO("FlatObjectStorageEngine::ForEachItem %{public}s GetEntries fail, errcode = %{public}d",
+            Anonymous::Change(key).c_str(), status);
         return ERR_DB_GET_FAIL;
     }
-    LOG_DEBUG("end GetEntries");
-    while (resultSet->IsAfterLast()) {
-        DistributedDB::Entry entry;
+    uint32_t ret = SUCCESS;
+    // One entry is reused for the whole scan so its buffers keep their capacity between rows.
+    DistributedDB::Entry entry;
+    while (resultSet->MoveToNext()) {
         status = resultSet->GetEntry(entry);
         if (status != DistributedDB::DBStatus::OK) {
-            LOG_INFO("FlatObjectStorageEngine::GetTable GetEntry fail, errcode = %{public}d", status);
-            status = delegate->CloseResultSet(resultSet);
-            if (status != DistributedDB::DBStatus::OK) {
-                LOG_INFO("KvStoreNbDelegate::CloseResultSet fail, errcode = %{public}d", status);
-                return ERR_RESULTSET;
-            }
-            return ERR_DB_ENTRY_FAIL;
+            LOG_INFO("FlatObjectStorageEngine::ForEachItem GetEntry fail, errcode = %{public}d", status);
+            ret = ERR_DB_ENTRY_FAIL;
+            break;
+        }
+        std::string_view itemKey(reinterpret_cast<const char *>(entry.key.data()), entry.key.size());
+        if (!visitor(itemKey, entry.value)) {
+            break;
         }
-        result.insert_or_assign(StringUtils::BytesToStr(entry.key), entry.value);
-        resultSet->MoveToNext();
     }
     status = delegate->CloseResultSet(resultSet);
     if (status != DistributedDB::DBStatus::OK) {
         LOG_INFO("KvStoreNbDelegate::CloseResultSet fail, errcode = %{public}d", status);
         return ERR_RESULTSET;
     }
-    return SUCCESS;
+    return ret;
 }
 
 uint32_t FlatObjectStorageEngine::UpdateItem(const std::string &key, const std::string &itemKey, Value &value)
@@ -198,20 +515,34 @@ uint32_t FlatObjectStorageEngine::UpdateItem(const std::string &key, const std::
     if (!isOpened_) {
         return ERR_DB_NOT_INIT;
     }
-    std::lock_guard<std::mutex> lock(operationMutex_);
-    if (delegates_.count(key) == 0) {
+    auto session = GetSession(key);
+    if (session == nullptr) {
         LOG_INFO("FlatObjectStorageEngine::GetTable %{public}s not exist", key.c_str());
         return ERR_DB_NOT_EXIST;
     }
-    auto delegate = delegates_.at(key);
-    LOG_DEBUG("start Put");
-    auto status = delegate->Put(StringUtils::StrToBytes(itemKey), value);
-    if (status != DistributedDB::DBStatus::OK) {
-        LOG_ERROR("%{public}s Put fail[%{public}d]", key.c_str(), status);
-        return ERR_CLOSE_STORAGE;
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->delegate == nullptr) {
+        return ERR_DB_NOT_EXIST;
     }
-    LOG_DEBUG("put success");
-    return SUCCESS;
+    if (uint32_t status = TakeFlushErrorLocked(key, *session); status != SUCCESS) {
+        return status;
+    }
+    keyIndex_.Insert(key, itemKey);
+    auto &buffer = session->buffer;
+    auto it = buffer.entries.find(itemKey);
+    if (it != buffer.entries.end()) {
+        buffer.bytes -= it->second.size();
+        it->second = value;
+    } else {
+        buffer.bytes += itemKey.size();
+        buffer.entries.emplace(itemKey, value);
+    }
+    buffer.bytes += value.size();
+    session->items->Put(itemKey, value);
+    if (buffer.entries.size() >= MAX_BUFFERED_ITEMS || buffer.bytes >= MAX_BUFFERED_BYTES) {
+        return FlushLocked(key, *session);
+    }
+    return ScheduleFlushLocked(key, *session);
 }
 
 uint32_t FlatObjectStorageEngine::UpdateItems(
@@ -220,25 +551,395 @@ uint32_t FlatObjectStorageEngine::UpdateItems(
     if (!isOpened_ || data.size() == 0) {
         return ERR_DB_NOT_INIT;
     }
-    std::lock_guard<std::mutex> lock(operationMutex_);
-    if (delegates_.count(key) == 0) {
+    auto session = GetSession(key);
+    if (session == nullptr) {
         LOG_INFO("FlatObjectStorageEngine::UpdateItems %{public}s not exist", key.c_str());
         return ERR_DB_NOT_EXIST;
     }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->delegate == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    if (uint32_t status = TakeFlushErrorLocked(key, *session); status != SUCCESS) {
+        return status;
+    }
+    if (session->buffer.entries.size() + data.size() > DistributedObject::MAX_BATCH_SIZE) {
+        // Too many for one transaction together, pending puts go first so data stays a single one.
+        uint32_t status = FlushLocked(key, *session);
+        if (status != SUCCESS) {
+            return status;
+        }
+    }
+    if (session->buffer.entries.empty()) {
+        uint32_t status = PutBatchLocked(key, *session, data);
+        if (status == SUCCESS) {
+            keyIndex_.Insert(key, data);
+            session->items->Put(data);
+        }
+        return status;
+    }
+    // Pending puts go out in the same batch, newer values in data win.
+    std::map<std::string, Value> merged = std::move(session->buffer.entries);
+    for (auto &item : data) {
+        merged.insert_or_assign(item.first, item.second);
+    }
+    DropWriteBufferLocked(*session);
+    uint32_t status = PutBatchLocked(key, *session, merged);
+    if (status != SUCCESS) {
+        OnFlushFailedLocked(key, *session, merged);
+        return status;
+    }
+    keyIndex_.Insert(key, data);
+    session->items->Put(data);
+    return SUCCESS;
+}
 
+uint32_t FlatObjectStorageEngine::PutBatchLocked(
+    const std::string &key, Session &session, const std::map<std::string, Value> &data)
+{
     std::vector<DistributedDB::Entry> entries;
+    entries.reserve(data.size());
     for (auto &item : data) {
         DistributedDB::Entry entry = { .key = StringUtils::StrToBytes(item.first), .value = item.second };
         entries.emplace_back(entry);
     }
-    auto delegate = delegates_.at(key);
     LOG_DEBUG("start PutBatch");
-    auto status = delegate->PutBatch(entries);
+    auto status = session.delegate->PutBatch(entries);
     if (status != DistributedDB::DBStatus::OK) {
         LOG_ERROR("%{public}s PutBatch fail[%{public}d]", key.c_str(), status);
         return ERR_CLOSE_STORAGE;
     }
     LOG_DEBUG("put success");
+    OnWrittenLocked(key, session, data);
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStorageEngine::Flush(const std::string &key)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        LOG_ERROR("Flush %{public}s not exist", Anonymous::Change(key).c_str());
+        return ERR_DB_NOT_EXIST;
+    }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (uint32_t status = TakeFlushErrorLocked(key, *session); status != SUCCESS) {
+        return status;
+    }
+    return FlushLocked(key, *session);
+}
+
+uint32_t FlatObjectStorageEngine::FlushLocked(const std::string &key, Session &session)
+{
+    if (session.buffer.entries.empty()) {
+        return SUCCESS;
+    }
+    std::map<std::string, Value> entries = std::move(session.buffer.entries);
+    DropWriteBufferLocked(session);
+    if (session.delegate == nullptr) {
+        return SUCCESS;
+    }
+    if (entries.size() == 1) {
+        auto status = session.delegate->Put(StringUtils::StrToBytes(entries.begin()->first),
+            entries.begin()->second);
+        if (status != DistributedDB::DBStatus::OK) {
+            LOG_ERROR("%{public}s Put fail[%{public}d]", Anonymous::Change(key).c_str(), status);
+            OnFlushFailedLocked(key, session, entries);
+            return ERR_CLOSE_STORAGE;
+        }
+        OnWrittenLocked(key, session, entries);
+        return SUCCESS;
+    }
+    uint32_t status = PutBatchLocked(key, session, entries);
+    if (status != SUCCESS) {
+        OnFlushFailedLocked(key, session, entries);
+    }
+    return status;
+}
+
+void FlatObjectStorageEngine::OnFlushFailedLocked(
+    const std::string &key, Session &session, const std::map<std::string, Value> &entries)
+{
+    // The lost puts were published and indexed when they were made, neither matches the store any more. The
+    // listener drops their cached values and marks them dirty again, the next save sends what the store holds.
+    session.items->Reset();
+    keyIndex_.Drop(key);
+    std::vector<std::string> keys;
+    keys.reserve(entries.size());
+    for (const auto &entry : entries) {
+        keys.push_back(entry.first);
+    }
+    OnDataChanged(key, keys);
+}
+
+void FlatObjectStorageEngine::RetainFlushErrorLocked(Session &session, uint32_t status)
+{
+    if (status != SUCCESS && session.flushError == SUCCESS) {
+        session.flushError = status;
+    }
+}
+
+uint32_t FlatObjectStorageEngine::TakeFlushErrorLocked(const std::string &key, Session &session)
+{
+    uint32_t status = session.flushError;
+    if (status != SUCCESS) {
+        LOG_ERROR("%{public}s earlier flush failed %{public}u", Anonymous::Change(key).c_str(), status);
+        session.flushError = SUCCESS;
+    }
+    return status;
+}
+
+std::shared_ptr<ExecutorPool> FlatObjectStorageEngine::GetExecutor()
+{
+    std::lock_guard<std::mutex> lock(executorMutex_);
+    if (executor_ == nullptr) {
+        executor_ = std::make_shared<ExecutorPool>(MAX_THREADS, MIN_THREADS, "OBJECT_FLUSH");
+    }
+    return executor_;
+}
+
+std::shared_ptr<ExecutorPool> FlatObjectStorageEngine::GetOpenExecutor()
+{
+    std::lock_guard<std::mutex> lock(executorMutex_);
+    if (openExecutor_ == nullptr) {
+        openExecutor_ = std::make_shared<ExecutorPool>(MAX_OPEN_THREADS, MIN_THREADS, "OBJECT_OPEN");
+    }
+    return openExecutor_;
+}
+
+uint32_t FlatObjectStorageEngine::ScheduleFlushLocked(const std::string &key, Session &session)
+{
+    if (session.buffer.flushTask != Executor::INVALID_TASK_ID) {
+        return SUCCESS;
+    }
+    std::weak_ptr<FlatObjectStorageEngine> weakEngine = weak_from_this();
+    if (weakEngine.expired()) {
+        // Not owned by a shared_ptr, no timer can outlive us safely, so write through.
+        return FlushLocked(key, session);
+    }
+    session.buffer.flushTask = GetExecutor()->Schedule(std::chrono::milliseconds(FLUSH_INTERVAL),
+        [weakEngine, key]() {
+            auto engine = weakEngine.lock();
+            if (engine == nullptr) {
+                return;
+            }
+            auto session = engine->GetSession(key);
+            if (session == nullptr) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(session->mutex);
+            session->buffer.flushTask = Executor::INVALID_TASK_ID;
+            engine->RetainFlushErrorLocked(*session, engine->FlushLocked(key, *session));
+        });
+    return SUCCESS;
+}
+
+void FlatObjectStorageEngine::DropWriteBufferLocked(Session &session)
+{
+    if (session.buffer.flushTask != Executor::INVALID_TASK_ID) {
+        GetExecutor()->Remove(session.buffer.flushTask);
+    }
+    session.buffer = WriteBuffer();
+}
+
+uint32_t FlatObjectStorageEngine::SetSyncPolicy(const std::string &key, SyncPolicy policy, uint32_t window)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    if (policy > SYNC_MANUAL || (policy == SYNC_WINDOWED && (window == 0 || window > MAX_SYNC_WINDOW))) {
+        LOG_ERROR("invalid sync policy %{public}d, window %{public}u", policy, window);
+        return ERR_INVALID_ARGS;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        LOG_ERROR("SetSyncPolicy %{public}s not exist", Anonymous::Change(key).c_str());
+        return ERR_DB_NOT_EXIST;
+    }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->delegate == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    bool autoSync = policy == SYNC_AUTO;
+    if (autoSync != (session->syncPolicy == SYNC_AUTO)) {
+        DistributedDB::PragmaData data = static_cast<DistributedDB::PragmaData>(&autoSync);
+        auto status = session->delegate->Pragma(DistributedDB::AUTO_SYNC, data);
+        if (status != DistributedDB::DBStatus::OK) {
+            LOG_ERROR("Set Pragma fail[%{public}d], store:%{public}s", status, Anonymous::Change(key).c_str());
+            return ERR_DB_SET_PROCESS;
+        }
+    }
+    bool pending = session->syncTask != Executor::INVALID_TASK_ID;
+    CancelSyncLocked(*session);
+    session->syncPolicy = policy;
+    session->syncWindow = window;
+    // Changes waiting for a window go out now, or with the new window. SYNC_MANUAL keeps them for Commit.
+    if (pending && policy != SYNC_MANUAL) {
+        ScheduleSyncLocked(key, *session, policy == SYNC_WINDOWED ? window : 0);
+    }
+    LOG_INFO("%{public}s sync policy %{public}d, window %{public}u", Anonymous::Change(key).c_str(), policy, window);
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStorageEngine::Commit(const std::string &key)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    return PushChanges(key);
+}
+
+uint32_t FlatObjectStorageEngine::GetSyncStats(const std::string &key, SyncStats &stats)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        LOG_ERROR("GetSyncStats %{public}s not exist", Anonymous::Change(key).c_str());
+        return ERR_DB_NOT_EXIST;
+    }
+    std::shared_ptr<SyncDeltaTracker> delta;
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        delta = session->delta;
+    }
+    stats = delta->GetStats();
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStorageEngine::GetVersion(const std::string &key, uint64_t &version)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        LOG_ERROR("GetVersion %{public}s not exist", Anonymous::Change(key).c_str());
+        return ERR_DB_NOT_EXIST;
+    }
+    version = session->items->GetVersion();
+    return SUCCESS;
+}
+
+void FlatObjectStorageEngine::OnWrittenLocked(
+    const std::string &key, Session &session, const std::map<std::string, Value> &entries)
+{
+    session.delta->OnWritten(entries);
+    if (session.syncPolicy == SYNC_WINDOWED) {
+        ScheduleSyncLocked(key, session, session.syncWindow);
+    }
+}
+
+void FlatObjectStorageEngine::ScheduleSyncLocked(const std::string &key, Session &session, uint32_t delay)
+{
+    if (session.syncTask != Executor::INVALID_TASK_ID) {
+        return;
+    }
+    std::weak_ptr<FlatObjectStorageEngine> weakEngine = weak_from_this();
+    if (weakEngine.expired()) {
+        // Not owned by a shared_ptr, no timer can outlive us safely, the changes wait for Commit.
+        return;
+    }
+    session.syncTask = GetOpenExecutor()->Schedule(std::chrono::milliseconds(delay), [weakEngine, key]() {
+        auto engine = weakEngine.lock();
+        if (engine != nullptr) {
+            engine->PushChanges(key);
+        }
+    });
+}
+
+void FlatObjectStorageEngine::CancelSyncLocked(Session &session)
+{
+    if (session.syncTask != Executor::INVALID_TASK_ID) {
+        GetOpenExecutor()->Remove(session.syncTask);
+        session.syncTask = Executor::INVALID_TASK_ID;
+    }
+}
+
+uint32_t FlatObjectStorageEngine::PushChanges(const std::string &key)
+{
+    // Listing the devices queries the device manager, so it is done before the session is locked.
+    std::vector<DeviceInfo> devices = SoftBusAdapter::GetInstance()->GetDeviceList();
+    std::vector<std::string> deviceIds;
+    deviceIds.reserve(devices.size());
+    for (const auto &device : devices) {
+        deviceIds.push_back(device.deviceId);
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        LOG_ERROR("PushChanges %{public}s not exist", Anonymous::Change(key).c_str());
+        return ERR_DB_NOT_EXIST;
+    }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->delegate == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    uint32_t ret = FlushLocked(key, *session);
+    // Everything written so far goes out with this push, including what the flush just scheduled.
+    CancelSyncLocked(*session);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    if (deviceIds.empty()) {
+        return SUCCESS;
+    }
+    auto onComplete = [key](const std::map<std::string, DistributedDB::DBStatus> &result) {
+        size_t failed = 0;
+        for (const auto &[device, status] : result) {
+            failed += status == DistributedDB::DBStatus::OK ? 0 : 1;
+        }
+        LOG_INFO("push %{public}s to %{public}zu devices, failed %{public}zu", Anonymous::Change(key).c_str(),
+            result.size(), failed);
+    };
+    return SyncLocked(key, *session, deviceIds, DistributedDB::SyncMode::SYNC_MODE_PUSH_ONLY, onComplete);
+}
+
+uint32_t FlatObjectStorageEngine::SyncLocked(const std::string &key, Session &session,
+    const std::vector<std::string> &deviceIds, DistributedDB::SyncMode mode, const SyncCallback &onComplete)
+{
+    SyncDeltaTracker::Delta delta;
+    if (mode != DistributedDB::SyncMode::SYNC_MODE_PULL_ONLY) {
+        delta = session.delta->GetPending(deviceIds);
+        if (delta.entries == 0 && mode == DistributedDB::SyncMode::SYNC_MODE_PUSH_ONLY) {
+            LOG_INFO("push %{public}s skipped, devices are up to date", Anonymous::Change(key).c_str());
+            return SUCCESS;
+        }
+        if (delta.entries == 0) {
+            mode = DistributedDB::SyncMode::SYNC_MODE_PULL_ONLY;
+        }
+    }
+    std::weak_ptr<SyncDeltaTracker> weakDelta = session.delta;
+    bool push = mode != DistributedDB::SyncMode::SYNC_MODE_PULL_ONLY;
+    auto callback = [weakDelta, push, seq = delta.seq, onComplete](
+                        const std::map<std::string, DistributedDB::DBStatus> &result) {
+        auto tracker = weakDelta.lock();
+        if (push && tracker != nullptr) {
+            for (const auto &[device, status] : result) {
+                if (status == DistributedDB::DBStatus::OK) {
+                    tracker->Acknowledge(device, seq);
+                }
+            }
+        }
+        if (onComplete) {
+            onComplete(result);
+        }
+    };
+    auto status = session.delegate->Sync(deviceIds, mode, callback);
+    if (status != DistributedDB::DBStatus::OK) {
+        LOG_ERROR("sync %{public}s mode %{public}d err %{public}d", Anonymous::Change(key).c_str(), mode, status);
+        return ERR_UNREGISTER;
+    }
+    if (push) {
+        session.delta->OnPushed(delta);
+        LOG_INFO("push %{public}s mode %{public}d to %{public}zu devices, entries:%{public}" PRIu64
+            ", bytes:%{public}" PRIu64, Anonymous::Change(key).c_str(), mode, deviceIds.size(), delta.entries,
+            delta.bytes);
+    } else {
+        session.delta->OnPulled();
+    }
     return SUCCESS;
 }
 
@@ -247,20 +948,46 @@ uint32_t FlatObjectStorageEngine::DeleteTable(const std::string &key)
     if (!isOpened_) {
         return ERR_DB_NOT_INIT;
     }
-    std::lock_guard<std::mutex> lock(operationMutex_);
-    if (delegates_.count(key) == 0) {
+    auto session = GetSession(key);
+    if (session == nullptr) {
         LOG_INFO("FlatObjectStorageEngine::GetTable %{public}s not exist", key.c_str());
         return ERR_DB_NOT_EXIST;
     }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->delegate == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
     LOG_DEBUG("start DeleteTable %{public}s", key.c_str());
-    auto status = storeManager_->CloseKvStore(delegates_.at(key));
+    FlushLocked(key, *session);
+    CancelSyncLocked(*session);
+    std::shared_ptr<DistributedDB::KvStoreDelegateManager> storeManager;
+    {
+        std::shared_lock<std::shared_mutex> sessionsLock(sessionMutex_);
+        storeManager = storeManager_;
+    }
+    if (storeManager == nullptr) {
+        return ERR_DB_NOT_INIT;
+    }
+    if (session->changeObserver != nullptr) {
+        session->delegate->UnRegisterObserver(session->changeObserver);
+        session->changeObserver = nullptr;
+    }
+    auto status = storeManager->CloseKvStore(session->delegate);
     if (status != DistributedDB::DBStatus::OK) {
         LOG_ERROR(
             "FlatObjectStorageEngine::CloseKvStore %{public}s CloseKvStore fail[%{public}d]", key.c_str(), status);
         return ERR_CLOSE_STORAGE;
     }
     LOG_DEBUG("DeleteTable success");
-    delegates_.erase(key);
+    keyIndex_.Drop(key);
+    session->items->Reset();
+    session->delegate = nullptr;
+    session->observer = nullptr;
+    std::unique_lock<std::shared_mutex> sessionsLock(sessionMutex_);
+    auto iter = sessions_.find(key);
+    if (iter != sessions_.end() && iter->second == session) {
+        sessions_.erase(iter);
+    }
     return SUCCESS;
 }
 
@@ -269,16 +996,36 @@ uint32_t FlatObjectStorageEngine::GetItem(const std::string &key, const std::str
     if (!isOpened_) {
         return ERR_DB_NOT_INIT;
     }
-    std::lock_guard<std::mutex> lock(operationMutex_);
-    if (delegates_.count(key) == 0) {
+    auto session = GetSession(key);
+    if (session == nullptr) {
         LOG_ERROR("FlatObjectStorageEngine::GetItem %{public}s not exist", key.c_str());
         return ERR_DB_NOT_EXIST;
     }
+    if (auto snapshot = session->items->Get(); snapshot != nullptr) {
+        auto item = snapshot->Find(itemKey);
+        if (item == nullptr) {
+            return ERR_ITEM_NOT_FOUND;
+        }
+        value = *item;
+        return SUCCESS;
+    }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->delegate == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    auto it = session->buffer.entries.find(itemKey);
+    if (it != session->buffer.entries.end()) {
+        value = it->second;
+        return SUCCESS;
+    }
     LOG_DEBUG("start Get %{public}s", key.c_str());
-    DistributedDB::DBStatus status = delegates_.at(key)->Get(StringUtils::StrToBytes(itemKey), value);
+    DistributedDB::DBStatus status = session->delegate->Get(StringUtils::StrToBytes(itemKey), value);
+    if (status == DistributedDB::DBStatus::NOT_FOUND) {
+        return ERR_ITEM_NOT_FOUND;
+    }
     if (status != DistributedDB::DBStatus::OK) {
         LOG_ERROR("FlatObjectStorageEngine::GetItem %{public}s item fail %{public}d", itemKey.c_str(), status);
-        return status;
+        return ERR_DB_GET_FAIL;
     }
     LOG_DEBUG("end Get %{public}s", key.c_str());
     return SUCCESS;
@@ -290,26 +1037,29 @@ uint32_t FlatObjectStorageEngine::RegisterObserver(const std::string &key, std::
         LOG_ERROR("FlatObjectStorageEngine::RegisterObserver kvStore has not init");
         return ERR_DB_NOT_INIT;
     }
-    std::lock_guard<std::mutex> lock(operationMutex_);
-    if (delegates_.count(key) == 0) {
+    auto session = GetSession(key);
+    if (session == nullptr) {
         LOG_INFO("FlatObjectStorageEngine::RegisterObserver %{public}s not exist", key.c_str());
         return ERR_DB_NOT_EXIST;
     }
-    if (observerMap_.count(key) != 0) {
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->delegate == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    if (session->observer != nullptr) {
         LOG_INFO("FlatObjectStorageEngine::RegisterObserver observer already exist.");
         return SUCCESS;
     }
-    auto delegate = delegates_.at(key);
     std::vector<uint8_t> tmpKey;
     LOG_DEBUG("start RegisterObserver %{public}s", key.c_str());
     DistributedDB::DBStatus status =
-        delegate->RegisterObserver(tmpKey, DistributedDB::ObserverMode::OBSERVER_CHANGES_FOREIGN, watcher);
+        session->delegate->RegisterObserver(tmpKey, DistributedDB::ObserverMode::OBSERVER_CHANGES_FOREIGN, watcher);
     if (status != DistributedDB::DBStatus::OK) {
         LOG_ERROR("FlatObjectStorageEngine::RegisterObserver watch err %{public}d", status);
         return ERR_REGISTER;
     }
     LOG_DEBUG("end RegisterObserver %{public}s", key.c_str());
-    observerMap_.insert_or_assign(key, watcher);
+    session->observer = watcher;
     return SUCCESS;
 }
 
@@ -319,26 +1069,27 @@ uint32_t FlatObjectStorageEngine::UnRegisterObserver(const std::string &key)
         LOG_ERROR("FlatObjectStorageEngine::RegisterObserver kvStore has not init");
         return ERR_DB_NOT_INIT;
     }
-    std::lock_guard<std::mutex> lock(operationMutex_);
-    if (delegates_.count(key) == 0) {
+    auto session = GetSession(key);
+    if (session == nullptr) {
         LOG_INFO("FlatObjectStorageEngine::RegisterObserver %{public}s not exist", key.c_str());
         return ERR_DB_NOT_EXIST;
     }
-    auto iter = observerMap_.find(key);
-    if (iter == observerMap_.end()) {
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->delegate == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    if (session->observer == nullptr) {
         LOG_ERROR("FlatObjectStorageEngine::UnRegisterObserver observer not exist.");
         return ERR_NO_OBSERVER;
     }
-    auto delegate = delegates_.at(key);
-    std::shared_ptr<TableWatcher> watcher = iter->second;
     LOG_DEBUG("start UnRegisterObserver %{public}s", key.c_str());
-    DistributedDB::DBStatus status = delegate->UnRegisterObserver(watcher);
+    DistributedDB::DBStatus status = session->delegate->UnRegisterObserver(session->observer);
     if (status != DistributedDB::DBStatus::OK) {
         LOG_ERROR("FlatObjectStorageEngine::UnRegisterObserver unRegister err %{public}d", status);
         return ERR_UNREGISTER;
     }
     LOG_DEBUG("end UnRegisterObserver %{public}s", key.c_str());
-    observerMap_.erase(key);
+    session->observer = nullptr;
     return SUCCESS;
 }
 
@@ -370,7 +1121,7 @@ uint32_t FlatObjectStorageEngine::SetStatusNotifier(std::shared_ptr<StatusWatche
                     }
                 }
             };
-            SyncAllData(storeId, std::vector<std::string>({ deviceId }), onComplete);
+            SyncOnline(storeId, deviceId, onComplete);
         } else {
             statusWatcher_->OnChanged(storeId, SoftBusAdapter::GetInstance()->ToNodeID(deviceId), "offline");
         }
@@ -394,24 +1145,28 @@ uint32_t FlatObjectStorageEngine::SetProgressNotifier(std::shared_ptr<ProgressWa
 }
 
 uint32_t FlatObjectStorageEngine::SyncAllData(const std::string &sessionId, const std::vector<std::string> &deviceIds,
-    const std::function<void(const std::map<std::string, DistributedDB::DBStatus> &)> &onComplete)
+    const SyncCallback &onComplete, DistributedDB::SyncMode mode)
 {
     LOG_INFO("start");
-    std::lock_guard<std::mutex> lock(operationMutex_);
-    if (delegates_.count(sessionId) == 0) {
+    auto session = GetSession(sessionId);
+    if (session == nullptr) {
         LOG_ERROR("%{public}s already deleted", Anonymous::Change(sessionId).c_str());
         return ERR_DB_NOT_EXIST;
     }
-    DistributedDB::KvStoreNbDelegate *kvstore = delegates_.at(sessionId);
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->delegate == nullptr) {
+        LOG_ERROR("%{public}s already deleted", Anonymous::Change(sessionId).c_str());
+        return ERR_DB_NOT_EXIST;
+    }
+    RetainFlushErrorLocked(*session, FlushLocked(sessionId, *session));
     if (deviceIds.empty()) {
         LOG_INFO("single device,no need sync");
         return ERR_SINGLE_DEVICE;
     }
     LOG_INFO("start sync %{public}s", Anonymous::Change(sessionId).c_str());
-    DistributedDB::DBStatus status = kvstore->Sync(deviceIds, DistributedDB::SyncMode::SYNC_MODE_PULL_ONLY, onComplete);
-    if (status != DistributedDB::DBStatus::OK) {
-        LOG_ERROR("sync err %{public}d", status);
-        return ERR_UNREGISTER;
+    uint32_t ret = SyncLocked(sessionId, *session, deviceIds, mode, onComplete);
+    if (ret != SUCCESS) {
+        return ret;
     }
     LOG_INFO("end sync %{public}s", Anonymous::Change(sessionId).c_str());
     return SUCCESS;
@@ -419,25 +1174,15 @@ uint32_t FlatObjectStorageEngine::SyncAllData(const std::string &sessionId, cons
 
 uint32_t FlatObjectStorageEngine::GetItems(const std::string &key, std::map<std::string, std::vector<uint8_t>> &data)
 {
-    if (!isOpened_) {
-        LOG_ERROR("GetItems %{public}s not init", Anonymous::Change(key).c_str());
-        return ERR_DB_NOT_INIT;
-    }
-    std::lock_guard<std::mutex> lock(operationMutex_);
-    if (delegates_.count(key) == 0) {
-        LOG_ERROR("GetItems %{public}s not exist", Anonymous::Change(key).c_str());
-        return ERR_DB_NOT_EXIST;
-    }
     LOG_INFO("start Get %{public}s", Anonymous::Change(key).c_str());
-    std::vector<DistributedDB::Entry> entries;
-    DistributedDB::DBStatus status = delegates_.at(key)->GetEntries(StringUtils::StrToBytes(""), entries);
-    if (status != DistributedDB::DBStatus::OK) {
+    uint32_t status = ForEachItem(key, [&data](std::string_view itemKey, const Value &value) {
+        data.insert_or_assign(std::string(itemKey), value);
+        return true;
+    });
+    if (status != SUCCESS) {
         LOG_ERROR("FlatObjectStorageEngine::GetItems item fail status = %{public}d", status);
         return status;
     }
-    for (auto &item : entries) {
-        data[StringUtils::BytesToStr(item.key)] = item.value;
-    }
     LOG_INFO("end Get %{public}s", Anonymous::Change(key).c_str());
     return SUCCESS;
 }
@@ -465,42 +1210,189 @@ bool FlatObjectStorageEngine::NotifyProgress(const std::string &sessionId, int32
 void FlatObjectStorageEngine::NotifyChange(
     const std::string &sessionId, const std::map<std::string, std::vector<uint8_t>> &changedData)
 {
-    std::lock_guard<std::mutex> lock(operationMutex_);
-    if (observerMap_.count(sessionId) == 0) {
+    auto session = GetSession(sessionId);
+    if (session == nullptr) {
         return;
     }
-    std::vector<std::string> data {};
+    std::shared_ptr<TableWatcher> observer;
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        observer = session->observer;
+    }
+    if (observer == nullptr) {
+        return;
+    }
+    ChangedKeys changedKeys;
+    changedKeys.Reserve(changedData.size());
     for (const auto &item : changedData) {
-        std::string key = item.first;
-        if (key.compare(0, FIELDS_PREFIX_LEN, FIELDS_PREFIX) == 0) {
-            key = key.substr(FIELDS_PREFIX_LEN);
+        changedKeys.AddStoredKey(item.first);
+    }
+    changedKeys.Finish();
+    observer->OnChangedKeys(sessionId, changedKeys, false);
+}
+
+void FlatObjectStorageEngine::SetDataChangeListener(DataChangeListener listener)
+{
+    std::lock_guard<std::mutex> lock(listenerMutex_);
+    dataChangeListener_ = std::move(listener);
+}
+
+void FlatObjectStorageEngine::OnDataChanged(const std::string &sessionId, const std::vector<std::string> &keys)
+{
+    DataChangeListener listener;
+    {
+        std::lock_guard<std::mutex> lock(listenerMutex_);
+        listener = dataChangeListener_;
+    }
+    if (listener) {
+        listener(sessionId, keys);
+    }
+}
+
+void FlatObjectStorageEngine::OnRemoteChanged(const std::string &sessionId,
+    const std::vector<std::string> &upserted, const std::vector<std::string> &deleted)
+{
+    keyIndex_.Apply(sessionId, upserted, deleted);
+    std::vector<std::string> keys = upserted;
+    keys.insert(keys.end(), deleted.begin(), deleted.end());
+    OnDataChanged(sessionId, keys);
+}
+
+DistributedDB::DBStatus FlatObjectStorageEngine::ReadEntries(
+    DistributedDB::KvStoreNbDelegate *delegate, std::map<std::string, Value> &values)
+{
+    DistributedDB::KvStoreResultSet *resultSet = nullptr;
+    Key emptyKey;
+    DistributedDB::DBStatus status = delegate->GetEntries(emptyKey, resultSet);
+    if (status == DistributedDB::DBStatus::NOT_FOUND) {
+        return DistributedDB::DBStatus::OK;
+    }
+    if (status != DistributedDB::DBStatus::OK || resultSet == nullptr) {
+        return status == DistributedDB::DBStatus::OK ? DistributedDB::DBStatus::DB_ERROR : status;
+    }
+    DistributedDB::Entry entry;
+    while (resultSet->MoveToNext() && resultSet->GetEntry(entry) == DistributedDB::DBStatus::OK) {
+        values.insert_or_assign(StringUtils::BytesToStr(entry.key), std::move(entry.value));
+    }
+    delegate->CloseResultSet(resultSet);
+    return DistributedDB::DBStatus::OK;
+}
+
+void FlatObjectStorageEngine::LoadItems(const std::string &key, DistributedDB::KvStoreNbDelegate *delegate,
+    VersionedItems &items)
+{
+    std::map<std::string, Value> values;
+    DistributedDB::DBStatus status = ReadEntries(delegate, values);
+    if (status != DistributedDB::DBStatus::OK) {
+        LOG_ERROR("load key index fail[%{public}d], store:%{public}s", status, Anonymous::Change(key).c_str());
+        keyIndex_.Drop(key);
+        items.Reset();
+        return;
+    }
+    std::vector<std::string> keys;
+    keys.reserve(values.size());
+    for (const auto &item : values) {
+        keys.push_back(item.first);
+    }
+    keyIndex_.Load(key, keys);
+    items.Load(std::move(values));
+}
+
+uint32_t FlatObjectStorageEngine::FilterExistingItems(
+    const std::string &key, std::map<std::string, std::vector<uint8_t>> &data)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    return keyIndex_.EraseExisting(key, data) ? SUCCESS : ERR_DB_NOT_EXIST;
+}
+
+FlatObjectStorageEngine::DataChangeObserver::DataChangeObserver(const std::string &sessionId,
+    std::weak_ptr<FlatObjectStorageEngine> engine, std::weak_ptr<Session> session)
+    : sessionId_(sessionId), engine_(std::move(engine)), session_(std::move(session))
+{
+}
+
+void FlatObjectStorageEngine::DataChangeObserver::OnChange(const DistributedDB::KvStoreChangedData &data)
+{
+    auto engine = engine_.lock();
+    if (engine == nullptr) {
+        return;
+    }
+    std::vector<std::string> upserted;
+    std::vector<std::string> deleted;
+    auto collect = [](const std::list<DistributedDB::Entry> &entries, std::vector<std::string> &keys) {
+        for (const auto &entry : entries) {
+            keys.push_back(StringUtils::BytesToStr(entry.key));
         }
-        data.push_back(key);
+    };
+    collect(data.GetEntriesInserted(), upserted);
+    collect(data.GetEntriesUpdated(), upserted);
+    collect(data.GetEntriesDeleted(), deleted);
+    if (upserted.empty() && deleted.empty()) {
+        return;
     }
-    observerMap_[sessionId]->OnChanged(sessionId, data, false);
+    // Published before the listeners hear of the change, so what they read back already includes it.
+    if (auto session = session_.lock(); session != nullptr) {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        if (session->delegate != nullptr && !session->items->IsDropped()) {
+            PublishLocked(*session, upserted, deleted);
+        }
+    }
+    engine->OnRemoteChanged(sessionId_, upserted, deleted);
 }
 
-void Watcher::OnChange(const DistributedDB::KvStoreChangedData &data)
+void FlatObjectStorageEngine::DataChangeObserver::PublishLocked(Session &session,
+    const std::vector<std::string> &upserted, const std::vector<std::string> &deleted)
 {
-    std::vector<std::string> changedData;
-    std::string tmp;
-    for (DistributedDB::Entry item : data.GetEntriesInserted()) {
-        tmp = StringUtils::BytesToStr(item.key);
-        LOG_INFO("inserted %{public}s", tmp.c_str());
-        // property key start with p_, 2 is p_ size
-        if (tmp.compare(0, FIELDS_PREFIX_LEN, FIELDS_PREFIX) == 0) {
-            changedData.push_back(tmp.substr(FIELDS_PREFIX_LEN));
+    // A key with a buffered put keeps the local value, the flush writes it over the remote one. The others are
+    // read back, a flush done after the remote write landed but before this event may have replaced it.
+    std::map<std::string, Value> values;
+    std::vector<std::string> removed;
+    for (const auto *keys : { &upserted, &deleted }) {
+        for (const auto &key : *keys) {
+            if (session.buffer.entries.count(key) != 0) {
+                continue;
+            }
+            Value value;
+            auto status = session.delegate->Get(StringUtils::StrToBytes(key), value);
+            if (status == DistributedDB::DBStatus::OK) {
+                values.insert_or_assign(key, std::move(value));
+            } else if (status == DistributedDB::DBStatus::NOT_FOUND) {
+                removed.push_back(key);
+            } else {
+                LOG_ERROR("read back fail[%{public}d], store:%{public}s", status,
+                    Anonymous::Change(sessionId_).c_str());
+                session.items->Reset();
+                return;
+            }
         }
     }
-    for (DistributedDB::Entry item : data.GetEntriesUpdated()) {
-        tmp = StringUtils::BytesToStr(item.key);
-        LOG_INFO("updated %{public}s", tmp.c_str());
-        // property key start with p_, 2 is p_ size
-        if (tmp.compare(0, FIELDS_PREFIX_LEN, FIELDS_PREFIX) == 0) {
-            changedData.push_back(tmp.substr(FIELDS_PREFIX_LEN));
+    session.items->Put(values, removed);
+}
+
+void Watcher::OnChange(const DistributedDB::KvStoreChangedData &data)
+{
+    const auto &inserted = data.GetEntriesInserted();
+    const auto &updated = data.GetEntriesUpdated();
+    ChangedKeys changedKeys;
+    changedKeys.Reserve(inserted.size() + updated.size());
+    for (const auto *entries : { &inserted, &updated }) {
+        for (const auto &entry : *entries) {
+            changedKeys.AddStoredKey(
+                std::string_view(reinterpret_cast<const char *>(entry.key.data()), entry.key.size()));
         }
     }
-    this->OnChanged(sessionId_, changedData, true);
+    changedKeys.Finish();
+    LOG_INFO("changed %{public}s, inserted:%{public}zu, updated:%{public}zu", Anonymous::Change(sessionId_).c_str(),
+        inserted.size(), updated.size());
+    OnChangedKeys(sessionId_, changedKeys, true);
+}
+
+void Watcher::OnChangedKeys(const std::string &sessionId, const ChangedKeys &changedKeys, bool enableTransfer)
+{
+    const auto &all = changedKeys.GetAll();
+    OnChanged(sessionId, std::vector<std::string>(all.begin(), all.end()), enableTransfer);
 }
 
 Watcher::Watcher(const std::string &sessionId) : sessionId_(sessionId)
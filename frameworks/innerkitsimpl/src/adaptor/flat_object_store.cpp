@@ -15,62 +15,250 @@
 
 #include "flat_object_store.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
 #include "accesstoken_kit.h"
 #include "anonymous.h"
+#include "asset_codec.h"
 #include "block_data.h"
-#include "bytes_utils.h"
 #include "client_adaptor.h"
 #include "ipc_skeleton.h"
+#include "memory_object_storage_engine.h"
 #include "object_callback_impl.h"
 #include "object_radar_reporter.h"
+#include "schema_codec.h"
 #include "string_utils.h"
+#include "value_codec.h"
+#include "value_compressor.h"
 
 namespace OHOS::ObjectStore {
-FlatObjectStore::FlatObjectStore(const std::string &bundleName)
+FlatObjectStore::FlatObjectStore(const std::string &bundleName, StorageType storageType)
 {
     bundleName_ = bundleName;
-    storageEngine_ = std::make_shared<FlatObjectStorageEngine>();
+    storageType_ = storageType;
+    valueCache_ = std::make_shared<ValueCache>();
+    dirtyKeys_ = std::make_shared<DirtyKeyTracker>();
+    assetRecords_ = std::make_shared<AssetRecordTracker>();
+    std::weak_ptr<ValueCache> weakCache = valueCache_;
+    std::weak_ptr<DirtyKeyTracker> weakDirtyKeys = dirtyKeys_;
+    std::weak_ptr<AssetRecordTracker> weakAssetRecords = assetRecords_;
+    dataChangeListener_ = [weakCache, weakDirtyKeys, weakAssetRecords](
+                              const std::string &sessionId, const std::vector<std::string> &keys) {
+        auto cache = weakCache.lock();
+        if (cache != nullptr) {
+            cache->Invalidate(sessionId, keys);
+        }
+        auto dirtyKeys = weakDirtyKeys.lock();
+        if (dirtyKeys != nullptr) {
+            dirtyKeys->MarkDirty(sessionId, keys);
+        }
+        auto assetRecords = weakAssetRecords.lock();
+        if (assetRecords != nullptr) {
+            assetRecords->OnChanged(sessionId, keys);
+        }
+    };
+    storageEngine_ = CreateEngine(storageType);
     uint32_t status = storageEngine_->Open(bundleName);
     if (status != SUCCESS) {
         LOG_ERROR("FlatObjectStore: Failed to open, error: open storage engine failure %{public}d", status);
     }
-    cacheManager_ = new CacheManager();
+    storageEngine_->SetDataChangeListener(dataChangeListener_);
+    cacheManager_ = std::make_shared<CacheManager>();
 }
 
 FlatObjectStore::~FlatObjectStore()
 {
-    if (storageEngine_ != nullptr) {
-        storageEngine_->Close();
-        storageEngine_ = nullptr;
+    {
+        std::unique_lock<std::shared_mutex> lock(lifetime_->mutex);
+        lifetime_->alive = false;
+    }
+    for (auto *engine : { &storageEngine_, &secondaryEngine_ }) {
+        if (*engine != nullptr) {
+            (*engine)->SetDataChangeListener(nullptr);
+            (*engine)->Close();
+            *engine = nullptr;
+        }
     }
-    delete cacheManager_;
+    LOG_INFO("value cache hit:%{public}" PRIu64 ", miss:%{public}" PRIu64, valueCache_->GetHitCount(),
+        valueCache_->GetMissCount());
     cacheManager_ = nullptr;
 }
 
-uint32_t FlatObjectStore::CreateObject(const std::string &sessionId)
+std::shared_ptr<ObjectStorageEngine> FlatObjectStore::CreateEngine(StorageType storageType)
+{
+    if (storageType == STORAGE_MEMORY) {
+        return std::make_shared<MemoryObjectStorageEngine>();
+    }
+    return std::make_shared<FlatObjectStorageEngine>();
+}
+
+std::shared_ptr<ObjectStorageEngine> FlatObjectStore::GetEngine(StorageType storageType)
+{
+    if (storageType == storageType_) {
+        return storageEngine_;
+    }
+    {
+        std::shared_lock<std::shared_mutex> lock(engineMutex_);
+        if (secondaryEngine_ != nullptr) {
+            return secondaryEngine_;
+        }
+    }
+    // Opened outside the lock, a concurrent caller that installs its engine first wins.
+    auto engine = CreateEngine(storageType);
+    uint32_t status = engine->Open(bundleName_);
+    if (status != SUCCESS) {
+        LOG_ERROR("FlatObjectStore: open storage engine %{public}d failure %{public}d", storageType, status);
+    }
+    engine->SetDataChangeListener(dataChangeListener_);
+    std::unique_lock<std::shared_mutex> lock(engineMutex_);
+    if (secondaryEngine_ == nullptr) {
+        engine->SetStatusNotifier(statusNotifier_);
+        engine->SetProgressNotifier(progressNotifier_);
+        secondaryEngine_ = engine;
+    }
+    return secondaryEngine_;
+}
+
+std::shared_ptr<ObjectStorageEngine> FlatObjectStore::GetEngine(const std::string &sessionId)
+{
+    std::shared_lock<std::shared_mutex> lock(engineMutex_);
+    auto it = sessionEngines_.find(sessionId);
+    return it == sessionEngines_.end() ? storageEngine_ : it->second;
+}
+
+std::shared_ptr<ObjectStorageEngine> FlatObjectStore::GetOpenedEngine(const std::string &sessionId)
+{
+    auto engine = GetEngine(sessionId);
+    if (!engine->isOpened_ && engine->Open(bundleName_) != SUCCESS) {
+        LOG_ERROR("FlatObjectStore::DB has not inited");
+        return nullptr;
+    }
+    return engine;
+}
+
+uint32_t FlatObjectStore::CheckCreate(const std::shared_ptr<ObjectStorageEngine> &engine, StorageType storageType)
 {
-    if (!cacheManager_->IsContinue()) { // NOT IN CONTINUE, CHECK PERMISSION
+    // Memory objects are never synced by DistributedDB, so they do not need the sync permission.
+    if (storageType == STORAGE_DISTRIBUTED && !cacheManager_->IsContinue()) { // NOT IN CONTINUE, CHECK PERMISSION
         auto tokenId = IPCSkeleton::GetSelfTokenID();
         int32_t ret = Security::AccessToken::AccessTokenKit::VerifyAccessToken(tokenId, DISTRIBUTED_DATASYNC);
         if (ret != Security::AccessToken::PermissionState::PERMISSION_GRANTED) {
             return ERR_NO_PERMISSION;
         }
     }
-    if (!storageEngine_->isOpened_ && storageEngine_->Open(bundleName_) != SUCCESS) {
+    if (!engine->isOpened_ && engine->Open(bundleName_) != SUCCESS) {
         LOG_ERROR("FlatObjectStore::DB has not inited");
         return ERR_DB_NOT_INIT;
     }
-    uint32_t status = storageEngine_->CreateTable(sessionId);
-    if (status != SUCCESS) {
-        LOG_ERROR("FlatObjectStore::CreateObject createTable err %{public}d", status);
-        return status;
+    return SUCCESS;
+}
+
+void FlatObjectStore::OnObjectCreated(const std::string &sessionId)
+{
+    valueCache_->Invalidate(sessionId);
+    dirtyKeys_->DropBaseline(sessionId);
+    assetRecords_->Clear(sessionId);
+    {
+        std::lock_guard<std::mutex> lock(schemaMutex_);
+        schemas_.erase(sessionId);
     }
     SubscribeDataChange(sessionId);
     ResumeObject(sessionId);
     SubscribeProgressChange(sessionId);
+}
+
+uint32_t FlatObjectStore::CreateObject(const std::string &sessionId)
+{
+    return CreateObject(sessionId, storageType_);
+}
+
+uint32_t FlatObjectStore::CreateObject(const std::string &sessionId, StorageType storageType)
+{
+    auto engine = GetEngine(storageType);
+    uint32_t status = CheckCreate(engine, storageType);
+    if (status != SUCCESS) {
+        return status;
+    }
+    status = BindEngine(sessionId, engine);
+    if (status != SUCCESS) {
+        return status;
+    }
+    status = engine->CreateTable(sessionId);
+    if (status != SUCCESS) {
+        LOG_ERROR("FlatObjectStore::CreateObject createTable err %{public}d", status);
+        UnbindEngine(sessionId, engine);
+        return status;
+    }
+    OnObjectCreated(sessionId);
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStore::BindEngine(const std::string &sessionId, const std::shared_ptr<ObjectStorageEngine> &engine)
+{
+    std::unique_lock<std::shared_mutex> lock(engineMutex_);
+    if (sessionEngines_.find(sessionId) != sessionEngines_.end()) {
+        LOG_ERROR("FlatObjectStore::CreateObject %{public}s already created", Anonymous::Change(sessionId).c_str());
+        return ERR_EXIST;
+    }
+    if (engine != storageEngine_) {
+        sessionEngines_.emplace(sessionId, engine);
+    }
     return SUCCESS;
 }
 
+void FlatObjectStore::UnbindEngine(const std::string &sessionId, const std::shared_ptr<ObjectStorageEngine> &engine)
+{
+    if (engine != storageEngine_) {
+        std::unique_lock<std::shared_mutex> lock(engineMutex_);
+        sessionEngines_.erase(sessionId);
+    }
+}
+
+void FlatObjectStore::CreateObjectAsync(const std::string &sessionId, const std::function<void(uint32_t)> &callback)
+{
+    CreateObjectAsync(sessionId, storageType_, callback);
+}
+
+void FlatObjectStore::CreateObjectAsync(
+    const std::string &sessionId, StorageType storageType, const std::function<void(uint32_t)> &callback)
+{
+    auto engine = GetEngine(storageType);
+    uint32_t status = CheckCreate(engine, storageType);
+    if (status == SUCCESS) {
+        status = BindEngine(sessionId, engine);
+    }
+    if (status != SUCCESS) {
+        callback(status);
+        return;
+    }
+    // The table may be created after this store is gone, the callback only touches it while lifetime says alive.
+    engine->CreateTableAsync(sessionId, [this, lifetime = lifetime_, engine, sessionId, callback](uint32_t status) {
+        {
+            std::shared_lock<std::shared_mutex> lock(lifetime->mutex);
+            if (!lifetime->alive) {
+                status = status == SUCCESS ? ERR_NULL_OBJECTSTORE : status;
+            } else if (status != SUCCESS) {
+                LOG_ERROR("FlatObjectStore::CreateObjectAsync createTable err %{public}d", status);
+                UnbindEngine(sessionId, engine);
+            } else {
+                OnObjectCreated(sessionId);
+            }
+        }
+        callback(status);
+    });
+}
+
+uint32_t FlatObjectStore::PrepareObject(const std::string &sessionId)
+{
+    uint32_t status = CheckCreate(storageEngine_, storageType_);
+    if (status != SUCCESS) {
+        return status;
+    }
+    return storageEngine_->PrepareTable(sessionId);
+}
+
 void FlatObjectStore::ResumeObject(const std::string &sessionId)
 {
     std::function<void(const std::map<std::string, std::vector<uint8_t>> &data, bool allReady)> callback =
@@ -81,15 +269,18 @@ void FlatObjectStore::ResumeObject(const std::string &sessionId)
             return;
         }
         LOG_INFO("retrieve success, data.size:%{public}zu, allReady:%{public}d", data.size(), allReady);
-        auto result = storageEngine_->UpdateItems(sessionId, data);
+        auto engine = GetEngine(sessionId);
+        auto result = engine->UpdateItems(sessionId, data);
         if (result != SUCCESS) {
             LOG_ERROR("UpdateItems failed, status = %{public}d", result);
         }
+        auto keys = GetKeys(data);
+        valueCache_->Invalidate(sessionId, keys);
+        dirtyKeys_->MarkDirty(sessionId, keys);
         if (allReady) {
             std::lock_guard<std::mutex> lck(mutex_);
-            if (find(retrievedCache_.begin(), retrievedCache_.end(), sessionId) == retrievedCache_.end()) {
-                retrievedCache_.push_back(sessionId);
-                storageEngine_->NotifyStatus(sessionId, "local", "restored");
+            if (retrievedCache_.insert(sessionId).second) {
+                engine->NotifyStatus(sessionId, "local", "restored");
             }
         }
     };
@@ -101,20 +292,23 @@ void FlatObjectStore::SubscribeDataChange(const std::string &sessionId)
     std::function<void(const std::map<std::string, std::vector<uint8_t>> &data, bool allReady)> remoteResumeCallback =
         [sessionId, this](const std::map<std::string, std::vector<uint8_t>> &data, bool allReady) {
             LOG_INFO("DataChange callback. data.size:%{public}zu, allReady:%{public}d", data.size(), allReady);
+            auto engine = GetEngine(sessionId);
             std::map<std::string, std::vector<uint8_t>> filteredData = data;
             FilterData(sessionId, filteredData);
             if (!filteredData.empty()) {
-                auto status = storageEngine_->UpdateItems(sessionId, filteredData);
+                auto status = engine->UpdateItems(sessionId, filteredData);
                 if (status != SUCCESS) {
                     LOG_ERROR("UpdateItems failed, status = %{public}d", status);
                 }
-                storageEngine_->NotifyChange(sessionId, filteredData);
+                auto keys = GetKeys(filteredData);
+                valueCache_->Invalidate(sessionId, keys);
+                dirtyKeys_->MarkDirty(sessionId, keys);
+                engine->NotifyChange(sessionId, filteredData);
             }
             if (allReady) {
                 std::lock_guard<std::mutex> lck(mutex_);
-                if (find(retrievedCache_.begin(), retrievedCache_.end(), sessionId) == retrievedCache_.end()) {
-                    retrievedCache_.push_back(sessionId);
-                    storageEngine_->NotifyStatus(sessionId, "local", "restored");
+                if (retrievedCache_.insert(sessionId).second) {
+                    engine->NotifyStatus(sessionId, "local", "restored");
                 }
             }
         };
@@ -125,7 +319,7 @@ void FlatObjectStore::SubscribeProgressChange(const std::string &sessionId)
 {
     std::function<void(int32_t progress)> remoteResumeCallback = [sessionId, this](int32_t progress) {
         LOG_INFO("asset progress = %{public}d", progress);
-        if (!storageEngine_->NotifyProgress(sessionId, progress)) {
+        if (!GetEngine(sessionId)->NotifyProgress(sessionId, progress)) {
             std::lock_guard<std::mutex> lck(progressInfoMutex_);
             progressInfoCache_.insert_or_assign(sessionId, progress);
         }
@@ -135,15 +329,27 @@ void FlatObjectStore::SubscribeProgressChange(const std::string &sessionId)
 
 uint32_t FlatObjectStore::Delete(const std::string &sessionId)
 {
-    if (!storageEngine_->isOpened_ && storageEngine_->Open(bundleName_) != SUCCESS) {
-        LOG_ERROR("FlatObjectStore::DB has not inited");
+    auto engine = GetOpenedEngine(sessionId);
+    if (engine == nullptr) {
         return ERR_DB_NOT_INIT;
     }
-    uint32_t status = storageEngine_->DeleteTable(sessionId);
+    uint32_t status = engine->DeleteTable(sessionId);
     if (status != SUCCESS) {
         LOG_ERROR("FlatObjectStore: Failed to delete object %{public}d", status);
         return status;
     }
+    if (engine != storageEngine_) {
+        std::unique_lock<std::shared_mutex> lock(engineMutex_);
+        sessionEngines_.erase(sessionId);
+    }
+    valueCache_->Invalidate(sessionId);
+    dirtyKeys_->DropBaseline(sessionId);
+    assetRecords_->Clear(sessionId);
+    {
+        std::lock_guard<std::mutex> lock(schemaMutex_);
+        schemas_.erase(sessionId);
+    }
+    SaveQueue::GetInstance()->CancelAll(sessionId);
     cacheManager_->UnregisterDataChange(bundleName_, sessionId);
     cacheManager_->DeleteSnapshot(bundleName_, sessionId);
     cacheManager_->UnregisterProgressChange(bundleName_, sessionId);
@@ -152,11 +358,11 @@ uint32_t FlatObjectStore::Delete(const std::string &sessionId)
 
 uint32_t FlatObjectStore::Watch(const std::string &sessionId, std::shared_ptr<FlatObjectWatcher> watcher)
 {
-    if (!storageEngine_->isOpened_ && storageEngine_->Open(bundleName_) != SUCCESS) {
-        LOG_ERROR("FlatObjectStore::DB has not inited");
+    auto engine = GetOpenedEngine(sessionId);
+    if (engine == nullptr) {
         return ERR_DB_NOT_INIT;
     }
-    uint32_t status = storageEngine_->RegisterObserver(sessionId, watcher);
+    uint32_t status = engine->RegisterObserver(sessionId, watcher);
     if (status != SUCCESS) {
         LOG_ERROR("FlatObjectStore::Watch failed %{public}d", status);
     }
@@ -165,11 +371,11 @@ uint32_t FlatObjectStore::Watch(const std::string &sessionId, std::shared_ptr<Fl
 
 uint32_t FlatObjectStore::UnWatch(const std::string &sessionId)
 {
-    if (!storageEngine_->isOpened_ && storageEngine_->Open(bundleName_) != SUCCESS) {
-        LOG_ERROR("FlatObjectStore::DB has not inited");
+    auto engine = GetOpenedEngine(sessionId);
+    if (engine == nullptr) {
         return ERR_DB_NOT_INIT;
     }
-    uint32_t status = storageEngine_->UnRegisterObserver(sessionId);
+    uint32_t status = engine->UnRegisterObserver(sessionId);
     if (status != SUCCESS) {
         LOG_ERROR("UnRegisterObserver failed %{public}d", status);
     }
@@ -178,20 +384,160 @@ uint32_t FlatObjectStore::UnWatch(const std::string &sessionId)
 
 uint32_t FlatObjectStore::Put(const std::string &sessionId, const std::string &key, std::vector<uint8_t> value)
 {
-    if (!storageEngine_->isOpened_ && storageEngine_->Open(bundleName_) != SUCCESS) {
-        LOG_ERROR("FlatObjectStore::DB has not inited");
+    auto engine = GetOpenedEngine(sessionId);
+    if (engine == nullptr) {
         return ERR_DB_NOT_INIT;
     }
-    return storageEngine_->UpdateItem(sessionId, key, value);
+    uint32_t status = engine->UpdateItem(sessionId, key, value);
+    if (status == SUCCESS) {
+        dirtyKeys_->MarkDirty(sessionId, key);
+    }
+    return status;
 }
 
 uint32_t FlatObjectStore::Get(const std::string &sessionId, const std::string &key, Bytes &value)
 {
-    if (!storageEngine_->isOpened_ && storageEngine_->Open(bundleName_) != SUCCESS) {
-        LOG_ERROR("FlatObjectStore::DB has not inited");
+    auto engine = GetOpenedEngine(sessionId);
+    if (engine == nullptr) {
         return ERR_DB_NOT_INIT;
     }
-    return storageEngine_->GetItem(sessionId, key, value);
+    return engine->GetItem(sessionId, key, value);
+}
+
+uint32_t FlatObjectStore::PutValue(
+    const std::string &sessionId, const std::string &key, Bytes &data, const DecodedValue &value)
+{
+    return PutField(sessionId, FIELDS_PREFIX + key, key.find(*ASSET_DOT) != std::string::npos, data, value);
+}
+
+uint32_t FlatObjectStore::PutField(const std::string &sessionId, const std::string &field, bool isAssetField,
+    Bytes &data, const DecodedValue &value)
+{
+    Bytes compressed;
+    uint64_t generation = valueCache_->GetGeneration();
+    uint32_t status = Put(sessionId, field, Compress(field, data, compressed) ? compressed : data);
+    if (status != SUCCESS) {
+        valueCache_->Invalidate(sessionId, { field });
+        return status;
+    }
+    valueCache_->Put(sessionId, field, value, generation);
+    if (isAssetField) {
+        assetRecords_->OnChanged(sessionId, { field });
+    }
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStore::GetValue(const std::string &sessionId, const std::string &key, DecodedValue &value)
+{
+    std::shared_ptr<const DecodedValue> shared;
+    uint32_t status = GetSharedValue(sessionId, key, shared);
+    if (status != SUCCESS) {
+        return status;
+    }
+    value = *shared;
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStore::GetSharedValue(
+    const std::string &sessionId, const std::string &key, std::shared_ptr<const DecodedValue> &value)
+{
+    return GetSharedField(sessionId, FIELDS_PREFIX + key, value);
+}
+
+uint32_t FlatObjectStore::GetSharedField(
+    const std::string &sessionId, const std::string &field, std::shared_ptr<const DecodedValue> &value)
+{
+    value = valueCache_->Get(sessionId, field);
+    if (value != nullptr) {
+        return SUCCESS;
+    }
+    uint64_t generation = valueCache_->GetGeneration();
+    Bytes data;
+    uint32_t status = Get(sessionId, field, data);
+    if (status != SUCCESS) {
+        return status;
+    }
+    auto decoded = std::make_shared<DecodedValue>();
+    status = DecodeValue(data, *decoded);
+    if (status != SUCCESS) {
+        return status;
+    }
+    value = decoded;
+    valueCache_->Fill(sessionId, field, value, generation);
+    return SUCCESS;
+}
+
+bool FlatObjectStore::Compress(const std::string &field, const Bytes &data, Bytes &compressed)
+{
+    size_t threshold = compressThreshold_.load(std::memory_order_relaxed);
+    if (threshold == 0 || data.size() <= threshold) {
+        return false;
+    }
+    // The service and peers read asset sub-fields and the device id as plain values when a save or sync
+    // transfers the asset, so only user fields are compressed.
+    if (field.find(ASSET_DOT) != std::string::npos || field == FIELDS_PREFIX + DEVICEID_KEY) {
+        return false;
+    }
+    return ValueCompressor::Compress(data, compressed);
+}
+
+Bytes FlatObjectStore::Encode(const DecodedValue &value)
+{
+    return std::visit([](const auto &item) {
+        using T = std::decay_t<decltype(item)>;
+        if constexpr (std::is_same_v<T, std::string>) {
+            return ValueCodec::EncodeString(item);
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return ValueCodec::EncodeBoolean(item);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return ValueCodec::EncodeDouble(item);
+        } else {
+            return ValueCodec::EncodeComplex(item);
+        }
+    }, value);
+}
+
+Bytes FlatObjectStore::EncodeValue(const std::string &field, const DecodedValue &value)
+{
+    Bytes data = Encode(value);
+    Bytes compressed;
+    return Compress(field, data, compressed) ? compressed : data;
+}
+
+uint32_t FlatObjectStore::DecodeValue(Bytes &data, DecodedValue &value)
+{
+    if (ValueCompressor::IsCompressed(data)) {
+        uint32_t status = ValueCompressor::Decompress(data, data);
+        if (status != SUCCESS) {
+            return status;
+        }
+    }
+    return ValueCodec::Decode(data, value);
+}
+
+std::vector<std::string> FlatObjectStore::GetKeys(const std::map<std::string, std::vector<uint8_t>> &data)
+{
+    std::vector<std::string> keys;
+    keys.reserve(data.size());
+    for (const auto &item : data) {
+        keys.push_back(item.first);
+    }
+    return keys;
+}
+
+uint64_t FlatObjectStore::GetCacheHitCount()
+{
+    return valueCache_->GetHitCount();
+}
+
+uint64_t FlatObjectStore::GetCacheMissCount()
+{
+    return valueCache_->GetMissCount();
+}
+
+void FlatObjectStore::SetCompressThreshold(size_t threshold)
+{
+    compressThreshold_.store(threshold, std::memory_order_relaxed);
 }
 
 uint32_t FlatObjectStore::SetStatusNotifier(std::shared_ptr<StatusWatcher> notifier)
@@ -200,6 +546,15 @@ uint32_t FlatObjectStore::SetStatusNotifier(std::shared_ptr<StatusWatcher> notif
         LOG_ERROR("FlatObjectStore::DB has not inited");
         return ERR_DB_NOT_INIT;
     }
+    std::shared_ptr<ObjectStorageEngine> secondaryEngine;
+    {
+        std::unique_lock<std::shared_mutex> lock(engineMutex_);
+        statusNotifier_ = notifier;
+        secondaryEngine = secondaryEngine_;
+    }
+    if (secondaryEngine != nullptr) {
+        secondaryEngine->SetStatusNotifier(notifier);
+    }
     return storageEngine_->SetStatusNotifier(notifier);
 }
 
@@ -209,33 +564,202 @@ uint32_t FlatObjectStore::SetProgressNotifier(std::shared_ptr<ProgressWatcher> n
         LOG_ERROR("FlatObjectStore::DB has not inited");
         return ERR_DB_NOT_INIT;
     }
+    std::shared_ptr<ObjectStorageEngine> secondaryEngine;
+    {
+        std::unique_lock<std::shared_mutex> lock(engineMutex_);
+        progressNotifier_ = notifier;
+        secondaryEngine = secondaryEngine_;
+    }
+    if (secondaryEngine != nullptr) {
+        secondaryEngine->SetProgressNotifier(notifier);
+    }
     return storageEngine_->SetProgressNotifier(notifier);
 }
+
 uint32_t FlatObjectStore::Save(const std::string &sessionId, const std::string &deviceId)
 {
-    RadarReporter::ReportStateStart(std::string(__FUNCTION__), SAVE, SAVE_TO_SERVICE, IDLE, START, bundleName_);
+    return WaitForSave([this, &sessionId, &deviceId](const SaveCallback &callback, SaveId &saveId) {
+        return SaveAsync(sessionId, deviceId, DEFAULT_SAVE_TIMEOUT, callback, saveId);
+    });
+}
+
+uint32_t FlatObjectStore::RevokeSave(const std::string &sessionId)
+{
+    return WaitForSave([this, &sessionId](const SaveCallback &callback, SaveId &saveId) {
+        return RevokeSaveAsync(sessionId, DEFAULT_SAVE_TIMEOUT, callback, saveId);
+    });
+}
+
+uint32_t FlatObjectStore::WaitForSave(const std::function<uint32_t(const SaveCallback &, SaveId &)> &submit)
+{
+    auto block = std::make_shared<BlockData<std::tuple<bool, uint32_t>, std::chrono::milliseconds>>(
+        DEFAULT_SAVE_TIMEOUT, std::tuple{ true, ERR_TIMEOUT });
+    SaveId saveId = INVALID_SAVE_ID;
+    uint32_t status = submit([block](uint32_t result) { block->SetValue({ false, result }); }, saveId);
+    if (status != SUCCESS) {
+        return status;
+    }
+    auto [timeout, result] = block->GetValue();
+    if (timeout) {
+        // Woken just before the deadline of the queue, stop the save so that it does not run unwaited.
+        SaveQueue::GetInstance()->Cancel(saveId);
+    }
+    return result;
+}
+
+uint32_t FlatObjectStore::SaveAsync(const std::string &sessionId, const std::string &deviceId, uint32_t timeout,
+    const SaveCallback &callback, SaveId &saveId)
+{
+    RadarReporter::ReportStateStart("Save", SAVE, SAVE_TO_SERVICE, IDLE, START, bundleName_);
+    if (cacheManager_ == nullptr) {
+        LOG_ERROR("FlatObjectStore::cacheManager_ is null");
+        return ERR_NULL_PTR;
+    }
+    if (callback == nullptr) {
+        LOG_ERROR("save callback is null");
+        return ERR_INVALID_ARGS;
+    }
+    auto task = std::make_shared<SaveTask>(
+        SaveTask{ bundleName_, sessionId, deviceId, GetEngine(sessionId), dirtyKeys_, cacheManager_ });
+    saveId = SaveQueue::GetInstance()->Submit(sessionId, timeout,
+        [task](const SaveQueue::Done &done) { return StartSave(task, done); }, callback);
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStore::RevokeSaveAsync(
+    const std::string &sessionId, uint32_t timeout, const SaveCallback &callback, SaveId &saveId)
+{
     if (cacheManager_ == nullptr) {
         LOG_ERROR("FlatObjectStore::cacheManager_ is null");
         return ERR_NULL_PTR;
     }
+    if (callback == nullptr) {
+        LOG_ERROR("revoke save callback is null");
+        return ERR_INVALID_ARGS;
+    }
+    // The baseline is dropped when the revoke runs, a save submitted before it would set it again.
+    auto revoke = [bundleName = bundleName_, sessionId, dirtyKeys = dirtyKeys_,
+        cacheManager = cacheManager_](const SaveQueue::Done &done) {
+        dirtyKeys->DropBaseline(sessionId);
+        return cacheManager->RevokeSave(bundleName, sessionId, done);
+    };
+    saveId = SaveQueue::GetInstance()->Submit(sessionId, timeout, revoke, callback);
+    return SUCCESS;
+}
+
+bool FlatObjectStore::CancelSave(SaveId saveId)
+{
+    return SaveQueue::GetInstance()->Cancel(saveId);
+}
+
+uint32_t FlatObjectStore::StartSave(const std::shared_ptr<SaveTask> &task, const SaveQueue::Done &done)
+{
+    std::set<std::string> dirtyKeys;
+    if (!task->dirtyKeys->Take(task->sessionId, task->deviceId, dirtyKeys)) {
+        return StartFullSave(task, done);
+    }
     std::map<std::string, std::vector<uint8_t>> objectData;
-    uint32_t status = storageEngine_->GetItems(sessionId, objectData);
+    for (const auto &key : dirtyKeys) {
+        if (!IsSavedKey(key)) {
+            continue;
+        }
+        Bytes value;
+        if (task->engine->GetItem(task->sessionId, key, value) != SUCCESS) {
+            // A delta has no way to remove a key, the full snapshot replaces what the service holds.
+            LOG_INFO("dirty key unreadable, save full snapshot");
+            return StartFullSave(task, done);
+        }
+        objectData.emplace(key, std::move(value));
+    }
+    LOG_INFO("delta save %{public}zu keys", objectData.size());
+    // ERR_IPC: service without delta support, ERR_DB_NOT_EXIST: service lost the baseline snapshot.
+    auto onResult = [task, dirtyKeys, done](uint32_t status) {
+        if (status == ERR_IPC || status == ERR_DB_NOT_EXIST) {
+            LOG_INFO("delta save unavailable %{public}d, save full snapshot", status);
+            status = StartFullSave(task, done);
+            if (status == SUCCESS) {
+                return;
+            }
+        } else if (status != SUCCESS) {
+            task->dirtyKeys->Restore(task->sessionId, task->deviceId, dirtyKeys);
+        }
+        done(status);
+    };
+    uint32_t status = task->cacheManager->SaveDelta(
+        task->bundleName, task->sessionId, task->deviceId, objectData, onResult);
+    if (status == SUCCESS) {
+        return SUCCESS;
+    }
+    if (status != ERR_IPC && status != ERR_DB_NOT_EXIST) {
+        task->dirtyKeys->Restore(task->sessionId, task->deviceId, dirtyKeys);
+        return status;
+    }
+    LOG_INFO("delta save unavailable %{public}d, save full snapshot", status);
+    return StartFullSave(task, done);
+}
+
+uint32_t FlatObjectStore::StartFullSave(const std::shared_ptr<SaveTask> &task, const SaveQueue::Done &done)
+{
+    // Baseline is reset before reading so that puts racing with this save stay dirty.
+    task->dirtyKeys->ResetBaseline(task->sessionId, task->deviceId);
+    std::map<std::string, std::vector<uint8_t>> objectData;
+    uint32_t status = task->engine->GetItems(task->sessionId, objectData);
     if (status != SUCCESS) {
         LOG_ERROR("FlatObjectStore::GetItems fail");
-        RadarReporter::ReportStateError(std::string(__FUNCTION__), SAVE, SAVE_TO_SERVICE,
-            RADAR_FAILED, status, FINISHED);
+        RadarReporter::ReportStateError("Save", SAVE, SAVE_TO_SERVICE, RADAR_FAILED, status, FINISHED);
+        task->dirtyKeys->DropBaseline(task->sessionId, task->deviceId);
         return status;
     }
-    return cacheManager_->Save(bundleName_, sessionId, deviceId, objectData);
+    for (auto it = objectData.begin(); it != objectData.end();) {
+        it = IsSavedKey(it->first) ? std::next(it) : objectData.erase(it);
+    }
+    status = task->cacheManager->Save(task->bundleName, task->sessionId, task->deviceId, objectData,
+        [task, done](uint32_t status) {
+            if (status != SUCCESS) {
+                task->dirtyKeys->DropBaseline(task->sessionId, task->deviceId);
+            }
+            done(status);
+        });
+    if (status != SUCCESS) {
+        task->dirtyKeys->DropBaseline(task->sessionId, task->deviceId);
+    }
+    return status;
 }
 
-uint32_t FlatObjectStore::RevokeSave(const std::string &sessionId)
+uint32_t FlatObjectStore::SetSyncPolicy(const std::string &sessionId, SyncPolicy policy, uint32_t window)
 {
-    if (cacheManager_ == nullptr) {
-        LOG_ERROR("FlatObjectStore::cacheManager_ is null");
-        return ERR_NULL_PTR;
+    auto engine = GetOpenedEngine(sessionId);
+    if (engine == nullptr) {
+        return ERR_DB_NOT_INIT;
+    }
+    return engine->SetSyncPolicy(sessionId, policy, window);
+}
+
+uint32_t FlatObjectStore::Commit(const std::string &sessionId)
+{
+    auto engine = GetOpenedEngine(sessionId);
+    if (engine == nullptr) {
+        return ERR_DB_NOT_INIT;
+    }
+    return engine->Commit(sessionId);
+}
+
+uint32_t FlatObjectStore::GetSyncStats(const std::string &sessionId, SyncStats &stats)
+{
+    auto engine = GetOpenedEngine(sessionId);
+    if (engine == nullptr) {
+        return ERR_DB_NOT_INIT;
     }
-    return cacheManager_->RevokeSave(bundleName_, sessionId);
+    return engine->GetSyncStats(sessionId, stats);
+}
+
+uint32_t FlatObjectStore::GetVersion(const std::string &sessionId, uint64_t &version)
+{
+    auto engine = GetOpenedEngine(sessionId);
+    if (engine == nullptr) {
+        return ERR_DB_NOT_INIT;
+    }
+    return engine->GetVersion(sessionId, version);
 }
 
 uint32_t FlatObjectStore::BindAssetStore(const std::string &sessionId, AssetBindInfo &bindInfo, Asset &assetValue)
@@ -258,10 +782,8 @@ uint32_t FlatObjectStore::BindAssetStore(const std::string &sessionId, AssetBind
 void FlatObjectStore::CheckRetrieveCache(const std::string &sessionId)
 {
     std::lock_guard<std::mutex> lck(mutex_);
-    auto iter = find(retrievedCache_.begin(), retrievedCache_.end(), sessionId);
-    if (iter != retrievedCache_.end()) {
-        storageEngine_->NotifyStatus(*iter, "local", "restored");
-        retrievedCache_.erase(iter);
+    if (retrievedCache_.erase(sessionId) != 0) {
+        GetEngine(sessionId)->NotifyStatus(sessionId, "local", "restored");
     }
 }
 
@@ -270,7 +792,7 @@ void FlatObjectStore::CheckProgressCache(const std::string &sessionId)
     std::lock_guard<std::mutex> lck(progressInfoMutex_);
     auto it = progressInfoCache_.find(sessionId);
     if (it != progressInfoCache_.end()) {
-        auto ret = storageEngine_->NotifyProgress(sessionId, it->second);
+        auto ret = GetEngine(sessionId)->NotifyProgress(sessionId, it->second);
         if (ret) {
             progressInfoCache_.erase(sessionId);
         }
@@ -279,97 +801,90 @@ void FlatObjectStore::CheckProgressCache(const std::string &sessionId)
 
 void FlatObjectStore::FilterData(const std::string &sessionId, std::map<std::string, std::vector<uint8_t>> &data)
 {
-    std::map<std::string, std::vector<uint8_t>> allData {};
-    storageEngine_->GetItems(sessionId, allData);
-    for (const auto &item : allData) {
-        data.erase(item.first);
+    auto engine = GetEngine(sessionId);
+    if (data.empty() || engine->FilterExistingItems(sessionId, data) == SUCCESS) {
+        return;
     }
+    engine->ForEachItem(sessionId, [&data](std::string_view itemKey, const Value &) {
+        data.erase(std::string(itemKey));
+        return !data.empty();
+    });
 }
 
 uint32_t FlatObjectStore::PutDouble(const std::string &sessionId, const std::string &key, double value)
 {
-    Bytes data;
-    Type type = Type::TYPE_DOUBLE;
-    BytesUtils::PutNum(&type, 0, sizeof(type), data);
-    BytesUtils::PutNum(&value, sizeof(type), sizeof(value), data);
-    return Put(sessionId, FIELDS_PREFIX + key, data);
+    Bytes data = ValueCodec::EncodeDouble(value);
+    return PutValue(sessionId, key, data, value);
 }
 
 uint32_t FlatObjectStore::PutBoolean(const std::string &sessionId, const std::string &key, bool value)
 {
-    Bytes data;
-    Type type = Type::TYPE_BOOLEAN;
-    BytesUtils::PutNum(&type, 0, sizeof(type), data);
-    BytesUtils::PutNum(&value, sizeof(type), sizeof(value), data);
-    return Put(sessionId, FIELDS_PREFIX + key, data);
+    Bytes data = ValueCodec::EncodeBoolean(value);
+    return PutValue(sessionId, key, data, value);
 }
 
 uint32_t FlatObjectStore::PutString(const std::string &sessionId, const std::string &key, const std::string &value)
 {
-    Bytes data;
-    Type type = Type::TYPE_STRING;
-    BytesUtils::PutNum(&type, 0, sizeof(type), data);
-    Bytes dst = StringUtils::StrToBytes(value);
-    data.insert(data.end(), dst.begin(), dst.end());
-    return Put(sessionId, FIELDS_PREFIX + key, data);
+    Bytes data = ValueCodec::EncodeString(value);
+    return PutValue(sessionId, key, data, value);
 }
 
 uint32_t FlatObjectStore::GetDouble(const std::string &sessionId, const std::string &key, double &value)
 {
-    Bytes data;
-    Bytes keyBytes = StringUtils::StrToBytes(key);
-    uint32_t status = Get(sessionId, FIELDS_PREFIX + key, data);
+    DecodedValue decoded;
+    uint32_t status = GetValue(sessionId, key, decoded);
     if (status != SUCCESS) {
         LOG_ERROR("GetDouble field not exist. %{public}d %{public}s", status, Anonymous::Change(key).c_str());
         return status;
     }
-    status = BytesUtils::GetNum(data, sizeof(Type), &value, sizeof(value));
-    if (status != SUCCESS) {
-        LOG_ERROR("GetDouble getNum err. %{public}d", status);
+    auto result = std::get_if<double>(&decoded);
+    if (result == nullptr) {
+        LOG_ERROR("GetDouble type err. %{public}zu", decoded.index());
+        return ERR_DATA_LEN;
     }
-    return status;
+    value = *result;
+    return SUCCESS;
 }
 
 uint32_t FlatObjectStore::GetBoolean(const std::string &sessionId, const std::string &key, bool &value)
 {
-    Bytes data;
-    Bytes keyBytes = StringUtils::StrToBytes(key);
-    uint32_t status = Get(sessionId, FIELDS_PREFIX + key, data);
+    DecodedValue decoded;
+    uint32_t status = GetValue(sessionId, key, decoded);
     if (status != SUCCESS) {
         LOG_ERROR("GetBoolean field not exist. %{public}d %{public}s", status, Anonymous::Change(key).c_str());
         return status;
     }
-    status = BytesUtils::GetNum(data, sizeof(Type), &value, sizeof(value));
-    if (status != SUCCESS) {
-        LOG_ERROR("GetBoolean getNum err. %{public}d", status);
-        return status;
+    auto result = std::get_if<bool>(&decoded);
+    if (result == nullptr) {
+        LOG_ERROR("GetBoolean type err. %{public}zu", decoded.index());
+        return ERR_DATA_LEN;
     }
+    value = *result;
     return SUCCESS;
 }
 
 uint32_t FlatObjectStore::GetString(const std::string &sessionId, const std::string &key, std::string &value)
 {
-    Bytes data;
-    uint32_t status = Get(sessionId, FIELDS_PREFIX + key, data);
+    DecodedValue decoded;
+    uint32_t status = GetValue(sessionId, key, decoded);
     if (status != SUCCESS) {
         LOG_ERROR("GetString field not exist. %{public}d %{public}s", status, Anonymous::Change(key).c_str());
         return status;
     }
-    status = StringUtils::BytesToStrWithType(data, value);
-    if (status != SUCCESS) {
-        LOG_ERROR("GetString dataToVal err. %{public}d", status);
+    auto result = std::get_if<std::string>(&decoded);
+    if (result == nullptr || result->empty()) {
+        LOG_ERROR("GetString dataToVal err. %{public}zu", decoded.index());
+        return ERR_DATA_LEN;
     }
-    return status;
+    value = *result;
+    return SUCCESS;
 }
 
 uint32_t FlatObjectStore::PutComplex(const std::string &sessionId, const std::string &key,
     const std::vector<uint8_t> &value)
 {
-    Bytes data;
-    Type type = Type::TYPE_COMPLEX;
-    BytesUtils::PutNum(&type, 0, sizeof(type), data);
-    data.insert(data.end(), value.begin(), value.end());
-    uint32_t status = Put(sessionId, FIELDS_PREFIX + key, data);
+    Bytes data = ValueCodec::EncodeComplex(value);
+    uint32_t status = PutValue(sessionId, key, data, value);
     if (status != SUCCESS) {
         LOG_ERROR("setField err %{public}d", status);
     }
@@ -379,31 +894,362 @@ uint32_t FlatObjectStore::PutComplex(const std::string &sessionId, const std::st
 uint32_t FlatObjectStore::GetComplex(const std::string &sessionId, const std::string &key,
     std::vector<uint8_t> &value)
 {
-    uint32_t status = Get(sessionId, FIELDS_PREFIX + key, value);
+    DecodedValue decoded;
+    uint32_t status = GetValue(sessionId, key, decoded);
     if (status != SUCCESS) {
         LOG_ERROR("field not exist. %{public}d %{public}s", status, Anonymous::Change(key).c_str());
         return status;
     }
-    value.erase(value.begin(), value.begin() + sizeof(Type));
-    return status;
+    auto result = std::get_if<std::vector<uint8_t>>(&decoded);
+    if (result == nullptr) {
+        LOG_ERROR("GetComplex type err. %{public}zu", decoded.index());
+        return ERR_DATA_LEN;
+    }
+    value = *result;
+    return SUCCESS;
 }
 
 uint32_t FlatObjectStore::GetType(const std::string &sessionId, const std::string &key, Type &type)
+{
+    DecodedValue decoded;
+    uint32_t status = GetValue(sessionId, key, decoded);
+    if (status != SUCCESS) {
+        LOG_ERROR("GetType field not exist. %{public}d %{public}s", status, Anonymous::Change(key).c_str());
+        return status;
+    }
+    type = static_cast<Type>(decoded.index());
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStore::GetView(const std::string &sessionId, const std::string &key, ValueView &value)
+{
+    std::shared_ptr<const DecodedValue> decoded;
+    uint32_t status = GetSharedValue(sessionId, key, decoded);
+    if (status != SUCCESS) {
+        LOG_ERROR("GetView field not exist. %{public}d %{public}s", status, Anonymous::Change(key).c_str());
+        return status;
+    }
+    MakeView(std::move(decoded), value);
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStore::PutView(const std::string &sessionId, const std::string &key, const ValueView &value)
+{
+    if (value.data == nullptr && value.size != 0) {
+        return ERR_INVALID_ARGS;
+    }
+    switch (value.type) {
+        case TYPE_STRING: {
+            std::string_view item(reinterpret_cast<const char *>(value.data), value.size);
+            Bytes data = ValueCodec::EncodeString(item);
+            return PutValue(sessionId, key, data, DecodedValue(std::in_place_type<std::string>, item));
+        }
+        case TYPE_BOOLEAN:
+            if (value.size == sizeof(bool)) {
+                return PutBoolean(sessionId, key, *value.data != 0);
+            }
+            break;
+        case TYPE_DOUBLE:
+            if (value.size == sizeof(double)) {
+                double item = 0;
+                std::memcpy(&item, value.data, sizeof(item));
+                return PutDouble(sessionId, key, item);
+            }
+            break;
+        case TYPE_COMPLEX: {
+            Bytes data = ValueCodec::EncodeComplex(value.data, value.size);
+            return PutValue(sessionId, key, data,
+                DecodedValue(std::in_place_type<std::vector<uint8_t>>, value.data, value.data + value.size));
+        }
+        default:
+            break;
+    }
+    LOG_ERROR("PutView invalid view, type:%{public}d, size:%{public}zu", value.type, value.size);
+    return ERR_INVALID_ARGS;
+}
+
+void FlatObjectStore::MakeView(std::shared_ptr<const DecodedValue> decoded, ValueView &value)
+{
+    value.type = static_cast<Type>(decoded->index());
+    std::visit([&value](const auto &item) {
+        using T = std::decay_t<decltype(item)>;
+        if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, double>) {
+            value.data = reinterpret_cast<const uint8_t *>(&item);
+            value.size = sizeof(item);
+        } else {
+            value.data = reinterpret_cast<const uint8_t *>(item.data());
+            value.size = item.size();
+        }
+    }, *decoded);
+    value.owner = std::move(decoded);
+}
+
+uint32_t FlatObjectStore::PutBatch(const std::string &sessionId, const std::map<std::string, FieldValue> &values)
+{
+    if (values.empty() || values.size() > DistributedObject::MAX_BATCH_SIZE) {
+        LOG_ERROR("PutBatch invalid size %{public}zu", values.size());
+        return ERR_INVALID_ARGS;
+    }
+    std::map<std::string, std::vector<uint8_t>> data;
+    return PutItems(sessionId, values, data);
+}
+
+uint32_t FlatObjectStore::PutItems(const std::string &sessionId, const std::map<std::string, FieldValue> &values,
+    std::map<std::string, std::vector<uint8_t>> &data)
+{
+    auto engine = GetOpenedEngine(sessionId);
+    if (engine == nullptr) {
+        return ERR_DB_NOT_INIT;
+    }
+    for (const auto &[key, value] : values) {
+        std::string field = FIELDS_PREFIX + key;
+        Bytes encoded = EncodeValue(field, value);
+        data.emplace(std::move(field), std::move(encoded));
+    }
+    auto fields = GetKeys(data);
+    uint64_t generation = valueCache_->GetGeneration();
+    uint32_t status = engine->UpdateItems(sessionId, data);
+    if (status != SUCCESS) {
+        LOG_ERROR("PutItems %{public}s failed %{public}d", Anonymous::Change(sessionId).c_str(), status);
+        valueCache_->Invalidate(sessionId, fields);
+        return status;
+    }
+    dirtyKeys_->MarkDirty(sessionId, fields);
+    std::vector<std::pair<std::string, DecodedValue>> written;
+    written.reserve(values.size());
+    for (const auto &[key, value] : values) {
+        written.emplace_back(FIELDS_PREFIX + key, value);
+    }
+    valueCache_->Put(sessionId, written, generation);
+    assetRecords_->OnChanged(sessionId, fields);
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStore::GetBatch(
+    const std::string &sessionId, const std::vector<std::string> &keys, std::map<std::string, FieldValue> &values)
+{
+    if (GetOpenedEngine(sessionId) == nullptr) {
+        return ERR_DB_NOT_INIT;
+    }
+    for (const auto &key : keys) {
+        std::shared_ptr<const DecodedValue> value;
+        if (GetSharedValue(sessionId, key, value) == SUCCESS) {
+            values.insert_or_assign(key, *value);
+        }
+    }
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStore::GetAll(const std::string &sessionId, std::map<std::string, FieldValue> &values)
+{
+    auto engine = GetOpenedEngine(sessionId);
+    if (engine == nullptr) {
+        return ERR_DB_NOT_INIT;
+    }
+    size_t invalid = 0;
+    uint32_t status = engine->ForEachItem(sessionId, [&values, &invalid](std::string_view itemKey, const Value &value) {
+        if (!IsFieldKey(itemKey)) {
+            return true;
+        }
+        Bytes data = value;
+        DecodedValue decoded;
+        if (DecodeValue(data, decoded) != SUCCESS) {
+            invalid++;
+            return true;
+        }
+        values.insert_or_assign(std::string(itemKey.substr(FIELDS_PREFIX_LEN)), std::move(decoded));
+        return true;
+    });
+    if (status != SUCCESS) {
+        LOG_ERROR("GetAll %{public}s failed %{public}d", Anonymous::Change(sessionId).c_str(), status);
+        return status;
+    }
+    if (invalid != 0) {
+        LOG_ERROR("GetAll %{public}s skipped %{public}zu invalid values", Anonymous::Change(sessionId).c_str(),
+            invalid);
+    }
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStore::PutAsset(const std::string &sessionId, const std::string &assetKey, const Asset &asset,
+    const std::string &deviceId)
+{
+    // The sub-fields stay the layout older peers and the service read, the record serves reads on this version.
+    std::map<std::string, FieldValue> values;
+    AssetCodec::ToFields(assetKey, asset, values);
+    if (!deviceId.empty()) {
+        values.insert_or_assign(DEVICEID_KEY, deviceId);
+    }
+    std::map<std::string, std::vector<uint8_t>> data;
+    data.emplace(RECORDS_PREFIX + assetKey + ASSET_RECORD_SUFFIX, AssetCodec::Encode(asset));
+    return PutItems(sessionId, values, data);
+}
+
+uint32_t FlatObjectStore::GetAsset(const std::string &sessionId, const std::string &assetKey, Asset &asset)
 {
     Bytes data;
-    uint32_t status = Get(sessionId, FIELDS_PREFIX + key, data);
+    Asset stored;
+    if (Get(sessionId, RECORDS_PREFIX + assetKey + ASSET_RECORD_SUFFIX, data) == SUCCESS &&
+        AssetCodec::Decode(data, stored) == SUCCESS &&
+        (assetRecords_->IsTrusted(sessionId, assetKey) || IsRecordCurrent(sessionId, assetKey, stored))) {
+        asset = std::move(stored);
+        return SUCCESS;
+    }
+    // Read paths never write: a record out of date stays untrusted until the next PutAsset rewrites it.
+    std::map<std::string, FieldValue> fields;
+    uint32_t status = GetBatch(sessionId, AssetCodec::GetFieldKeys(assetKey), fields);
     if (status != SUCCESS) {
-        LOG_ERROR("GetString field not exist. %{public}d %{public}s", status, Anonymous::Change(key).c_str());
         return status;
     }
-    status = BytesUtils::GetNum(data, 0, &type, sizeof(type));
+    if (!AssetCodec::FromFields(assetKey, fields, asset)) {
+        LOG_ERROR("asset not complete %{public}s", Anonymous::Change(assetKey).c_str());
+        return ERR_DB_GET_FAIL;
+    }
+    return SUCCESS;
+}
+
+bool FlatObjectStore::IsRecordCurrent(const std::string &sessionId, const std::string &assetKey, const Asset &record)
+{
+    std::map<std::string, FieldValue> fields;
+    return GetBatch(sessionId, AssetCodec::GetCheckKeys(assetKey), fields) == SUCCESS &&
+        AssetCodec::MatchesFields(assetKey, fields, record);
+}
+
+PropertyHandle FlatObjectStore::GetPropertyHandle(const std::string &key)
+{
+    if (key.empty()) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(propertyMutex_);
+    auto it = properties_.find(key);
+    if (it != properties_.end()) {
+        return it->second;
+    }
+    auto property = std::make_shared<PropertyKey>();
+    property->key = key;
+    property->storedKey = FIELDS_PREFIX + key;
+    property->isAssetField = key.find(*ASSET_DOT) != std::string::npos;
+    if (properties_.size() < MAX_INTERNED_KEYS) {
+        properties_.emplace(key, property);
+    }
+    return property;
+}
+
+uint32_t FlatObjectStore::Put(const std::string &sessionId, const PropertyHandle &handle, const DecodedValue &value)
+{
+    if (handle == nullptr) {
+        return ERR_INVALID_ARGS;
+    }
+    Bytes data = Encode(value);
+    return PutField(sessionId, handle->storedKey, handle->isAssetField, data, value);
+}
+
+uint32_t FlatObjectStore::Get(const std::string &sessionId, const PropertyHandle &handle, DecodedValue &value)
+{
+    if (handle == nullptr) {
+        return ERR_INVALID_ARGS;
+    }
+    std::shared_ptr<const DecodedValue> shared;
+    uint32_t status = GetSharedField(sessionId, handle->storedKey, shared);
     if (status != SUCCESS) {
-        LOG_ERROR("GetBoolean getNum err. %{public}d", status);
         return status;
     }
+    value = *shared;
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStore::GetView(const std::string &sessionId, const PropertyHandle &handle, ValueView &value)
+{
+    if (handle == nullptr) {
+        return ERR_INVALID_ARGS;
+    }
+    std::shared_ptr<const DecodedValue> decoded;
+    uint32_t status = GetSharedField(sessionId, handle->storedKey, decoded);
+    if (status != SUCCESS) {
+        return status;
+    }
+    MakeView(std::move(decoded), value);
+    return SUCCESS;
+}
+
+uint32_t FlatObjectStore::BindSchema(const std::string &sessionId, const ObjectSchema &schema)
+{
+    if (schema.name.empty() || schema.types.empty() || schema.types.size() > SchemaCodec::MAX_FIELD_COUNT) {
+        LOG_ERROR("invalid schema, name:%{public}s, fields:%{public}zu", schema.name.c_str(), schema.types.size());
+        return ERR_INVALID_ARGS;
+    }
+    std::lock_guard<std::mutex> lock(schemaMutex_);
+    auto it = schemas_.find(sessionId);
+    if (it != schemas_.end()) {
+        // Records already written keep their field indexes, so a schema may only grow at the end.
+        const auto &bound = it->second;
+        if (bound.name != schema.name || bound.types.size() > schema.types.size() ||
+            !std::equal(bound.types.begin(), bound.types.end(), schema.types.begin())) {
+            LOG_ERROR("schema %{public}s not compatible with bound %{public}s", schema.name.c_str(),
+                bound.name.c_str());
+            return ERR_INVALID_ARGS;
+        }
+    }
+    schemas_.insert_or_assign(sessionId, schema);
     return SUCCESS;
 }
 
+bool FlatObjectStore::GetSchema(const std::string &sessionId, ObjectSchema &schema)
+{
+    std::lock_guard<std::mutex> lock(schemaMutex_);
+    auto it = schemas_.find(sessionId);
+    if (it == schemas_.end()) {
+        LOG_ERROR("no schema bound to %{public}s", Anonymous::Change(sessionId).c_str());
+        return false;
+    }
+    schema = it->second;
+    return true;
+}
+
+uint32_t FlatObjectStore::PutRecord(const std::string &sessionId, const SchemaRecord &record)
+{
+    ObjectSchema schema;
+    if (!GetSchema(sessionId, schema)) {
+        return ERR_INVALID_ARGS;
+    }
+    // Fields the record does not set keep their stored values, so writers of different fields keep each other's.
+    std::lock_guard<std::mutex> lock(recordMutex_);
+    SchemaRecord merged;
+    Bytes stored;
+    uint32_t status = Get(sessionId, SCHEMA_RECORD_KEY, stored);
+    if (status == SUCCESS && SchemaCodec::Decode(schema, stored, merged) != SUCCESS) {
+        LOG_ERROR("replace invalid record of %{public}s", Anonymous::Change(sessionId).c_str());
+        merged = SchemaRecord();
+    } else if (status != SUCCESS && status != ObjectStorageEngine::ERR_ITEM_NOT_FOUND) {
+        return status;
+    }
+    for (size_t index = 0; index < record.GetFieldCount(); index++) {
+        if (record.Has(index)) {
+            merged.Set(index, *record.Get(index));
+        }
+    }
+    Bytes data;
+    status = SchemaCodec::Encode(schema, merged, data);
+    if (status != SUCCESS) {
+        return status;
+    }
+    return Put(sessionId, SCHEMA_RECORD_KEY, std::move(data));
+}
+
+uint32_t FlatObjectStore::GetRecord(const std::string &sessionId, SchemaRecord &record)
+{
+    ObjectSchema schema;
+    if (!GetSchema(sessionId, schema)) {
+        return ERR_INVALID_ARGS;
+    }
+    Bytes data;
+    uint32_t status = Get(sessionId, SCHEMA_RECORD_KEY, data);
+    if (status != SUCCESS) {
+        return status;
+    }
+    return SchemaCodec::Decode(schema, data, record);
+}
+
 std::string FlatObjectStore::GetBundleName()
 {
     return bundleName_;
@@ -416,37 +1262,62 @@ CacheManager::CacheManager()
 uint32_t CacheManager::Save(const std::string &bundleName, const std::string &sessionId, const std::string &deviceId,
     const std::map<std::string, std::vector<uint8_t>> &objectData)
 {
-    std::unique_lock<std::mutex> lck(mutex_);
-    auto block = std::make_shared<BlockData<std::tuple<bool, int32_t>>>(WAIT_TIME, std::tuple{ true, ERR_DB_GET_FAIL });
-    int32_t status = SaveObject(bundleName, sessionId, deviceId, objectData,
-        [deviceId, block](const std::map<std::string, int32_t> &results) {
-            LOG_INFO("CacheManager::task callback");
-            if (results.count(deviceId) != 0) {
-                block->SetValue({ false, results.at(deviceId) });
-            } else {
-                block->SetValue({ false, ERR_DB_GET_FAIL });
-            }
-        });
-    if (status != SUCCESS) {
-        LOG_ERROR("SaveObject failed");
-        return status;
-    }
-    LOG_INFO("CacheManager::start wait");
-    auto [timeout, res] = block->GetValue();
-    LOG_INFO("CacheManager::end wait, timeout: %{public}d, result: %{public}d", timeout, res);
-    return res;
+    return Wait([&](const ResultCallback &callback) {
+        return Save(bundleName, sessionId, deviceId, objectData, callback);
+    });
+}
+
+uint32_t CacheManager::Save(const std::string &bundleName, const std::string &sessionId, const std::string &deviceId,
+    const std::map<std::string, std::vector<uint8_t>> &objectData, const ResultCallback &callback)
+{
+    return SaveObject(bundleName, sessionId, deviceId, objectData, ForDevice(deviceId, callback));
+}
+
+uint32_t CacheManager::SaveDelta(const std::string &bundleName, const std::string &sessionId,
+    const std::string &deviceId, const std::map<std::string, std::vector<uint8_t>> &objectData)
+{
+    return Wait([&](const ResultCallback &callback) {
+        return SaveDelta(bundleName, sessionId, deviceId, objectData, callback);
+    });
+}
+
+uint32_t CacheManager::SaveDelta(const std::string &bundleName, const std::string &sessionId,
+    const std::string &deviceId, const std::map<std::string, std::vector<uint8_t>> &objectData,
+    const ResultCallback &callback)
+{
+    return SaveDeltaObject(bundleName, sessionId, deviceId, objectData, ForDevice(deviceId, callback));
 }
 
 uint32_t CacheManager::RevokeSave(const std::string &bundleName, const std::string &sessionId)
 {
-    std::unique_lock<std::mutex> lck(mutex_);
-    auto block = std::make_shared<BlockData<std::tuple<bool, int32_t>>>(WAIT_TIME, std::tuple{ true, ERR_DB_GET_FAIL });
-    int32_t status = RevokeSaveObject(bundleName, sessionId, [block](int32_t result) {
+    return Wait([&](const ResultCallback &callback) { return RevokeSave(bundleName, sessionId, callback); });
+}
+
+uint32_t CacheManager::RevokeSave(
+    const std::string &bundleName, const std::string &sessionId, const ResultCallback &callback)
+{
+    return RevokeSaveObject(bundleName, sessionId, [callback](int32_t result) {
         LOG_INFO("CacheManager::task callback");
-        block->SetValue({ false, result });
+        callback(result);
     });
+}
+
+std::function<void(const std::map<std::string, int32_t> &)> CacheManager::ForDevice(
+    const std::string &deviceId, const ResultCallback &callback)
+{
+    return [deviceId, callback](const std::map<std::string, int32_t> &results) {
+        LOG_INFO("CacheManager::task callback");
+        auto it = results.find(deviceId);
+        callback(it != results.end() ? it->second : ERR_DB_GET_FAIL);
+    };
+}
+
+uint32_t CacheManager::Wait(const std::function<uint32_t(const ResultCallback &)> &send)
+{
+    auto block = std::make_shared<BlockData<std::tuple<bool, int32_t>>>(WAIT_TIME, std::tuple{ true, ERR_DB_GET_FAIL });
+    uint32_t status = send([block](uint32_t result) { block->SetValue({ false, result }); });
     if (status != SUCCESS) {
-        LOG_ERROR("RevokeSaveObject failed");
+        LOG_ERROR("send to object service failed");
         return status;
     }
     LOG_INFO("CacheManager::start wait");
@@ -485,6 +1356,28 @@ int32_t CacheManager::SaveObject(const std::string &bundleName, const std::strin
     return status;
 }
 
+int32_t CacheManager::SaveDeltaObject(const std::string &bundleName, const std::string &sessionId,
+    const std::string &deviceId, const std::map<std::string, std::vector<uint8_t>> &objectData,
+    const std::function<void(const std::map<std::string, int32_t> &)> &callback)
+{
+    sptr<OHOS::DistributedObject::IObjectService> proxy = ClientAdaptor::GetObjectService();
+    if (proxy == nullptr) {
+        LOG_ERROR("proxy is nullptr.");
+        return ERR_PROCESSING;
+    }
+    sptr<ObjectSaveCallbackBroker> objectSaveCallback = new (std::nothrow) ObjectSaveCallback(callback);
+    if (objectSaveCallback == nullptr) {
+        LOG_ERROR("CacheManager::SaveDeltaObject no memory for ObjectSaveCallback malloc!");
+        return ERR_NULL_PTR;
+    }
+    int32_t status = proxy->ObjectStoreSaveDelta(
+        bundleName, sessionId, deviceId, objectData, objectSaveCallback->AsObject().GetRefPtr());
+    if (status != SUCCESS) {
+        LOG_ERROR("object delta save failed code=%{public}d.", static_cast<int>(status));
+    }
+    return status;
+}
+
 int32_t CacheManager::RevokeSaveObject(
     const std::string &bundleName, const std::string &sessionId, const std::function<void(int32_t)> &callback)
 {
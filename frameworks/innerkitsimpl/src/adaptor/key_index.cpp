@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "key_index.h"
+
+namespace OHOS::ObjectStore {
+void KeyIndex::Begin(const std::string &sessionId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    sessions_.insert_or_assign(sessionId, SessionKeys());
+}
+
+void KeyIndex::Load(const std::string &sessionId, const std::vector<std::string> &keys)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = sessions_.find(sessionId);
+    if (session == sessions_.end()) {
+        return;
+    }
+    auto &index = session->second;
+    for (const auto &key : keys) {
+        if (index.deleted.count(key) == 0) {
+            index.keys.insert(key);
+        }
+    }
+    index.deleted.clear();
+    index.loaded = true;
+}
+
+void KeyIndex::Insert(const std::string &sessionId, const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = sessions_.find(sessionId);
+    if (session == sessions_.end()) {
+        return;
+    }
+    session->second.keys.insert(key);
+    session->second.deleted.erase(key);
+}
+
+void KeyIndex::Insert(const std::string &sessionId, const std::map<std::string, std::vector<uint8_t>> &data)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = sessions_.find(sessionId);
+    if (session == sessions_.end()) {
+        return;
+    }
+    for (const auto &[key, value] : data) {
+        session->second.keys.insert(key);
+        session->second.deleted.erase(key);
+    }
+}
+
+void KeyIndex::Apply(const std::string &sessionId, const std::vector<std::string> &upserted,
+    const std::vector<std::string> &deleted)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = sessions_.find(sessionId);
+    if (session == sessions_.end()) {
+        return;
+    }
+    auto &index = session->second;
+    for (const auto &key : upserted) {
+        index.keys.insert(key);
+        index.deleted.erase(key);
+    }
+    for (const auto &key : deleted) {
+        index.keys.erase(key);
+        if (!index.loaded) {
+            index.deleted.insert(key);
+        }
+    }
+}
+
+bool KeyIndex::EraseExisting(const std::string &sessionId, std::map<std::string, std::vector<uint8_t>> &data)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = sessions_.find(sessionId);
+    if (session == sessions_.end() || !session->second.loaded) {
+        return false;
+    }
+    const auto &keys = session->second.keys;
+    for (auto it = data.begin(); it != data.end();) {
+        if (keys.count(it->first) != 0) {
+            it = data.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return true;
+}
+
+void KeyIndex::Drop(const std::string &sessionId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    sessions_.erase(sessionId);
+}
+} // namespace OHOS::ObjectStore
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "memory_object_storage_engine.h"
+
+#include "anonymous.h"
+#include "logger.h"
+#include "objectstore_errors.h"
+
+namespace OHOS::ObjectStore {
+uint32_t MemoryObjectStorageEngine::Open(const std::string &bundleName)
+{
+    std::unique_lock<std::shared_mutex> lock(sessionMutex_);
+    isOpened_ = true;
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::Close()
+{
+    std::unique_lock<std::shared_mutex> lock(sessionMutex_);
+    sessions_.clear();
+    isOpened_ = false;
+    return SUCCESS;
+}
+
+std::shared_ptr<MemoryObjectStorageEngine::Session> MemoryObjectStorageEngine::GetSession(const std::string &key)
+{
+    std::shared_lock<std::shared_mutex> lock(sessionMutex_);
+    auto iter = sessions_.find(key);
+    if (iter == sessions_.end()) {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+uint32_t MemoryObjectStorageEngine::CreateTable(const std::string &key)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    auto session = std::make_shared<Session>();
+    session->items.Load({});
+    std::unique_lock<std::shared_mutex> lock(sessionMutex_);
+    if (!sessions_.emplace(key, session).second) {
+        LOG_ERROR("table: %{public}s already created", Anonymous::Change(key).c_str());
+        return ERR_EXIST;
+    }
+    return SUCCESS;
+}
+
+void MemoryObjectStorageEngine::CreateTableAsync(
+    const std::string &key, const std::function<void(uint32_t status)> &callback)
+{
+    uint32_t status = CreateTable(key);
+    if (callback) {
+        callback(status);
+    }
+}
+
+uint32_t MemoryObjectStorageEngine::PrepareTable(const std::string &key)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    return GetSession(key) != nullptr ? ERR_EXIST : SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::DeleteTable(const std::string &key)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    std::unique_lock<std::shared_mutex> lock(sessionMutex_);
+    if (sessions_.erase(key) == 0) {
+        LOG_INFO("MemoryObjectStorageEngine::DeleteTable %{public}s not exist", Anonymous::Change(key).c_str());
+        return ERR_DB_NOT_EXIST;
+    }
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::GetTable(const std::string &key, std::map<std::string, Value> &result)
+{
+    result.clear();
+    return ForEachItem(key, [&result](std::string_view itemKey, const Value &value) {
+        result.insert_or_assign(std::string(itemKey), value);
+        return true;
+    });
+}
+
+uint32_t MemoryObjectStorageEngine::ForEachItem(const std::string &key, const ItemVisitor &visitor)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    if (visitor == nullptr) {
+        return ERR_INVALID_ARGS;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        LOG_INFO("MemoryObjectStorageEngine::ForEachItem %{public}s not exist", Anonymous::Change(key).c_str());
+        return ERR_DB_NOT_EXIST;
+    }
+    session->items.Get()->ForEach(visitor);
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::UpdateItem(const std::string &key, const std::string &itemKey, Value &value)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    session->items.Put(itemKey, value);
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::UpdateItems(
+    const std::string &key, const std::map<std::string, std::vector<uint8_t>> &data)
+{
+    if (!isOpened_ || data.size() == 0) {
+        return ERR_DB_NOT_INIT;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    session->items.Put(data);
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::GetItem(const std::string &key, const std::string &itemKey, Value &value)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    auto item = session->items.Get()->Find(itemKey);
+    if (item == nullptr) {
+        return ERR_ITEM_NOT_FOUND;
+    }
+    value = *item;
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::GetItems(
+    const std::string &key, std::map<std::string, std::vector<uint8_t>> &data)
+{
+    return ForEachItem(key, [&data](std::string_view itemKey, const Value &value) {
+        data.insert_or_assign(std::string(itemKey), value);
+        return true;
+    });
+}
+
+uint32_t MemoryObjectStorageEngine::FilterExistingItems(
+    const std::string &key, std::map<std::string, std::vector<uint8_t>> &data)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    auto snapshot = session->items.Get();
+    for (auto it = data.begin(); it != data.end();) {
+        it = snapshot->Find(it->first) != nullptr ? data.erase(it) : std::next(it);
+    }
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::Flush(const std::string &key)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    return GetSession(key) == nullptr ? ERR_DB_NOT_EXIST : SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::SetSyncPolicy(const std::string &key, SyncPolicy policy, uint32_t window)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    // Nothing is synced from this engine, any policy is met already.
+    return GetSession(key) == nullptr ? ERR_DB_NOT_EXIST : SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::Commit(const std::string &key)
+{
+    return Flush(key);
+}
+
+uint32_t MemoryObjectStorageEngine::GetSyncStats(const std::string &key, SyncStats &stats)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    if (GetSession(key) == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    stats = SyncStats();
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::GetVersion(const std::string &key, uint64_t &version)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    version = session->items.GetVersion();
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::RegisterObserver(const std::string &key, std::shared_ptr<TableWatcher> watcher)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->observer == nullptr) {
+        session->observer = watcher;
+    }
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::UnRegisterObserver(const std::string &key)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    auto session = GetSession(key);
+    if (session == nullptr) {
+        return ERR_DB_NOT_EXIST;
+    }
+    std::lock_guard<std::mutex> lock(session->mutex);
+    if (session->observer == nullptr) {
+        return ERR_NO_OBSERVER;
+    }
+    session->observer = nullptr;
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::SetStatusNotifier(std::shared_ptr<StatusWatcher> watcher)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    std::lock_guard<std::mutex> lock(watcherMutex_);
+    statusWatcher_ = watcher;
+    return SUCCESS;
+}
+
+uint32_t MemoryObjectStorageEngine::SetProgressNotifier(std::shared_ptr<ProgressWatcher> watcher)
+{
+    if (!isOpened_) {
+        return ERR_DB_NOT_INIT;
+    }
+    std::lock_guard<std::mutex> lock(progressMutex_);
+    progressWatcher_ = watcher;
+    return SUCCESS;
+}
+
+void MemoryObjectStorageEngine::NotifyStatus(
+    const std::string &sessionId, const std::string &deviceId, const std::string &status)
+{
+    std::lock_guard<std::mutex> lock(watcherMutex_);
+    if (statusWatcher_ == nullptr) {
+        return;
+    }
+    statusWatcher_->OnChanged(sessionId, deviceId, status);
+}
+
+bool MemoryObjectStorageEngine::NotifyProgress(const std::string &sessionId, int32_t progress)
+{
+    std::lock_guard<std::mutex> lock(progressMutex_);
+    if (progressWatcher_ == nullptr) {
+        return false;
+    }
+    progressWatcher_->OnChanged(sessionId, progress);
+    return true;
+}
+
+void MemoryObjectStorageEngine::NotifyChange(
+    const std::string &sessionId, const std::map<std::string, std::vector<uint8_t>> &changedData)
+{
+    auto session = GetSession(sessionId);
+    if (session == nullptr) {
+        return;
+    }
+    std::shared_ptr<TableWatcher> observer;
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        observer = session->observer;
+    }
+    if (observer == nullptr) {
+        return;
+    }
+    ChangedKeys changedKeys;
+    changedKeys.Reserve(changedData.size());
+    for (const auto &item : changedData) {
+        changedKeys.AddStoredKey(item.first);
+    }
+    changedKeys.Finish();
+    observer->OnChangedKeys(sessionId, changedKeys, false);
+}
+
+void MemoryObjectStorageEngine::SetDataChangeListener(DataChangeListener listener)
+{
+    // No remote device writes into this engine, every change already passes through FlatObjectStore.
+}
+} // namespace OHOS::ObjectStore
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "save_queue.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <vector>
+
+#include "anonymous.h"
+#include "logger.h"
+#include "objectstore_errors.h"
+
+namespace OHOS::ObjectStore {
+std::shared_ptr<SaveQueue> SaveQueue::GetInstance()
+{
+    static std::shared_ptr<SaveQueue> instance = std::make_shared<SaveQueue>();
+    return instance;
+}
+
+std::shared_ptr<ExecutorPool> SaveQueue::GetExecutor()
+{
+    std::lock_guard<std::mutex> lock(executorMutex_);
+    if (executor_ == nullptr) {
+        executor_ = std::make_shared<ExecutorPool>(MAX_THREADS, MIN_THREADS, "OBJECT_SAVE");
+    }
+    return executor_;
+}
+
+uint64_t SaveQueue::Submit(const std::string &sessionId, uint32_t timeout, Task task, Done callback)
+{
+    uint64_t id = 0;
+    Task runnable;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        id = ++nextId_;
+        auto &queue = sessions_[sessionId];
+        queue.push_back(id);
+        if (queue.size() == 1) {
+            runnable = std::move(task);
+        }
+        operations_.emplace(id, Operation{ sessionId, std::move(task), std::move(callback) });
+    }
+    auto executor = GetExecutor();
+    std::weak_ptr<SaveQueue> weakQueue = weak_from_this();
+    auto deadlineTask = executor->Schedule(std::chrono::milliseconds(timeout), [weakQueue, id]() {
+        auto queue = weakQueue.lock();
+        if (queue != nullptr && queue->Complete(id, ERR_TIMEOUT)) {
+            LOG_ERROR("save %{public}" PRIu64 " timed out", id);
+        }
+    });
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = operations_.find(id);
+        if (it != operations_.end()) {
+            it->second.deadlineTask = deadlineTask;
+        }
+    }
+    if (runnable != nullptr) {
+        Start(id, std::move(runnable));
+    }
+    return id;
+}
+
+bool SaveQueue::Cancel(uint64_t id)
+{
+    return Complete(id, ERR_CANCELED);
+}
+
+void SaveQueue::CancelAll(const std::string &sessionId)
+{
+    std::vector<uint64_t> ids;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = sessions_.find(sessionId);
+        if (it == sessions_.end()) {
+            return;
+        }
+        ids.assign(it->second.begin(), it->second.end());
+    }
+    LOG_INFO("cancel %{public}zu saves of %{public}s", ids.size(), Anonymous::Change(sessionId).c_str());
+    for (auto id : ids) {
+        Complete(id, ERR_CANCELED);
+    }
+}
+
+size_t SaveQueue::GetPendingCount(const std::string &sessionId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sessions_.find(sessionId);
+    return it == sessions_.end() ? 0 : it->second.size();
+}
+
+void SaveQueue::Start(uint64_t id, Task task)
+{
+    std::weak_ptr<SaveQueue> weakQueue = weak_from_this();
+    GetExecutor()->Execute([weakQueue, id, task = std::move(task)]() {
+        auto queue = weakQueue.lock();
+        if (queue == nullptr) {
+            return;
+        }
+        Done done = [weakQueue, id](uint32_t status) {
+            auto queue = weakQueue.lock();
+            if (queue != nullptr) {
+                queue->Finish(id, status);
+            }
+        };
+        uint32_t status = task(done);
+        if (status != SUCCESS) {
+            queue->Finish(id, status);
+        }
+    });
+}
+
+bool SaveQueue::Complete(uint64_t id, uint32_t status)
+{
+    Done callback;
+    Executor::TaskId deadlineTask = Executor::INVALID_TASK_ID;
+    bool detached = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = operations_.find(id);
+        if (it == operations_.end() || it->second.detached) {
+            return false;
+        }
+        auto &operation = it->second;
+        callback = std::move(operation.callback);
+        deadlineTask = operation.deadlineTask;
+        operation.deadlineTask = Executor::INVALID_TASK_ID;
+        auto session = sessions_.find(operation.sessionId);
+        if (session != sessions_.end() && !session->second.empty() && session->second.front() == id) {
+            // Its request is still in flight, the session stays blocked until the task answers.
+            operation.detached = true;
+            detached = true;
+        } else {
+            if (session != sessions_.end()) {
+                auto &queue = session->second;
+                queue.erase(std::remove(queue.begin(), queue.end(), id), queue.end());
+            }
+            operations_.erase(it);
+        }
+    }
+    auto executor = GetExecutor();
+    if (deadlineTask != Executor::INVALID_TASK_ID) {
+        executor->Remove(deadlineTask);
+    }
+    if (detached) {
+        std::weak_ptr<SaveQueue> weakQueue = weak_from_this();
+        auto releaseTask = executor->Schedule(std::chrono::milliseconds(DETACHED_TIMEOUT), [weakQueue, id]() {
+            auto queue = weakQueue.lock();
+            if (queue != nullptr) {
+                queue->Finish(id, ERR_TIMEOUT);
+            }
+        });
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = operations_.find(id);
+        if (it != operations_.end()) {
+            it->second.deadlineTask = releaseTask;
+        }
+    }
+    if (callback != nullptr) {
+        callback(status);
+    }
+    return true;
+}
+
+void SaveQueue::Finish(uint64_t id, uint32_t status)
+{
+    Done callback;
+    Executor::TaskId deadlineTask = Executor::INVALID_TASK_ID;
+    uint64_t nextId = 0;
+    Task next;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = operations_.find(id);
+        if (it == operations_.end()) {
+            // Answered already, or released after DETACHED_TIMEOUT.
+            return;
+        }
+        if (it->second.detached && status == ERR_TIMEOUT) {
+            LOG_ERROR("save %{public}" PRIu64 " got no answer, releasing its session", id);
+        }
+        callback = std::move(it->second.callback);
+        deadlineTask = it->second.deadlineTask;
+        auto session = sessions_.find(it->second.sessionId);
+        operations_.erase(it);
+        if (session != sessions_.end()) {
+            auto &queue = session->second;
+            bool running = !queue.empty() && queue.front() == id;
+            queue.erase(std::remove(queue.begin(), queue.end(), id), queue.end());
+            if (running && !queue.empty()) {
+                nextId = queue.front();
+                next = std::move(operations_[nextId].task);
+            }
+            if (queue.empty()) {
+                sessions_.erase(session);
+            }
+        }
+    }
+    if (deadlineTask != Executor::INVALID_TASK_ID) {
+        GetExecutor()->Remove(deadlineTask);
+    }
+    if (next != nullptr) {
+        Start(nextId, std::move(next));
+    }
+    if (callback != nullptr) {
+        callback(status);
+    }
+}
+} // namespace OHOS::ObjectStore
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "schema_codec.h"
+
+#include "logger.h"
+#include "objectstore_errors.h"
+#include "value_codec.h"
+
+namespace OHOS::ObjectStore {
+namespace {
+constexpr size_t HEADER_LEN = ValueCodec::TAG_LEN + sizeof(SchemaCodec::VERSION);
+constexpr size_t TYPE_BITS = 2;
+constexpr size_t TYPES_PER_BYTE = 8 / TYPE_BITS;
+constexpr uint8_t TYPE_MASK = (1 << TYPE_BITS) - 1;
+
+size_t BitmapLen(size_t count)
+{
+    return (count + 7) / 8;
+}
+} // namespace
+
+bool SchemaCodec::IsRecord(const Bytes &data)
+{
+    return !data.empty() && data[0] == ValueCodec::TAG_SCHEMA;
+}
+
+uint32_t SchemaCodec::Encode(const ObjectSchema &schema, const SchemaRecord &record, Bytes &data)
+{
+    size_t count = record.GetFieldCount();
+    while (count > 0 && !record.Has(count - 1)) {
+        count--;
+    }
+    if (count > schema.types.size()) {
+        LOG_ERROR("field %{public}zu not in schema %{public}s", count - 1, schema.name.c_str());
+        return ERR_INVALID_ARGS;
+    }
+    size_t present = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const FieldValue *value = record.Get(i);
+        if (value == nullptr) {
+            continue;
+        }
+        if (value->index() != schema.types[i]) {
+            LOG_ERROR("field %{public}zu of schema %{public}s has type %{public}zu", i, schema.name.c_str(),
+                value->index());
+            return ERR_INVALID_ARGS;
+        }
+        present++;
+    }
+    Bytes result;
+    result.reserve(HEADER_LEN + ValueCodec::MAX_VARINT_LEN + BitmapLen(count) + BitmapLen(present * TYPE_BITS));
+    result.push_back(ValueCodec::TAG_SCHEMA);
+    result.push_back(VERSION);
+    ValueCodec::PutVarint(count, result);
+    size_t bitmap = result.size();
+    size_t types = bitmap + BitmapLen(count);
+    result.resize(types + BitmapLen(present * TYPE_BITS));
+    for (size_t i = 0, slot = 0; i < count; ++i) {
+        if (!record.Has(i)) {
+            continue;
+        }
+        result[bitmap + i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+        result[types + slot / TYPES_PER_BYTE] |= static_cast<uint8_t>(schema.types[i] << (slot % TYPES_PER_BYTE *
+            TYPE_BITS));
+        slot++;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        const FieldValue *value = record.Get(i);
+        if (value != nullptr) {
+            PutPayload(*value, result);
+        }
+    }
+    data = std::move(result);
+    return SUCCESS;
+}
+
+uint32_t SchemaCodec::Decode(const ObjectSchema &schema, const Bytes &data, SchemaRecord &record)
+{
+    if (data.size() < HEADER_LEN || !IsRecord(data) || data[ValueCodec::TAG_LEN] == 0) {
+        LOG_ERROR("not a schema record, size:%{public}zu", data.size());
+        return ERR_DATA_LEN;
+    }
+    const uint8_t *src = data.data() + HEADER_LEN;
+    const uint8_t *end = data.data() + data.size();
+    uint64_t count = 0;
+    if (!ValueCodec::GetVarint(src, end, count) || count > MAX_FIELD_COUNT ||
+        BitmapLen(count) > static_cast<size_t>(end - src)) {
+        LOG_ERROR("bad schema record header, size:%{public}zu", data.size());
+        return ERR_DATA_LEN;
+    }
+    const uint8_t *bitmap = src;
+    size_t present = 0;
+    for (size_t i = 0; i < count; ++i) {
+        present += (bitmap[i / 8] >> (i % 8)) & 1;
+    }
+    const uint8_t *types = bitmap + BitmapLen(count);
+    if (BitmapLen(present * TYPE_BITS) > static_cast<size_t>(end - types)) {
+        LOG_ERROR("truncated schema record, size:%{public}zu", data.size());
+        return ERR_DATA_LEN;
+    }
+    src = types + BitmapLen(present * TYPE_BITS);
+    SchemaRecord result(schema.types.size());
+    for (size_t i = 0, slot = 0; i < count; ++i) {
+        if (((bitmap[i / 8] >> (i % 8)) & 1) == 0) {
+            continue;
+        }
+        auto type = static_cast<Type>((types[slot / TYPES_PER_BYTE] >> (slot % TYPES_PER_BYTE * TYPE_BITS)) &
+            TYPE_MASK);
+        slot++;
+        FieldValue value;
+        if (!GetPayload(type, src, end, value)) {
+            LOG_ERROR("truncated field %{public}zu, size:%{public}zu", i, data.size());
+            return ERR_DATA_LEN;
+        }
+        if (i >= schema.types.size()) {
+            continue;
+        }
+        if (type != schema.types[i]) {
+            LOG_ERROR("field %{public}zu of schema %{public}s stored as type %{public}d", i, schema.name.c_str(),
+                type);
+            return ERR_DATA_LEN;
+        }
+        result.Set(i, std::move(value));
+    }
+    record = std::move(result);
+    return SUCCESS;
+}
+
+void SchemaCodec::PutPayload(const FieldValue &value, Bytes &data)
+{
+    std::visit([&data](const auto &field) {
+        using T = std::decay_t<decltype(field)>;
+        if constexpr (std::is_same_v<T, bool>) {
+            data.push_back(field ? 1 : 0);
+        } else if constexpr (std::is_same_v<T, double>) {
+            size_t offset = data.size();
+            data.resize(offset + sizeof(double));
+            ValueCodec::StoreFixed(data.data() + offset, field);
+        } else {
+            ValueCodec::PutVarint(field.size(), data);
+            data.insert(data.end(), field.begin(), field.end());
+        }
+    }, value);
+}
+
+bool SchemaCodec::GetPayload(Type type, const uint8_t *&src, const uint8_t *end, FieldValue &value)
+{
+    size_t left = static_cast<size_t>(end - src);
+    switch (type) {
+        case TYPE_BOOLEAN:
+            if (left < sizeof(uint8_t)) {
+                return false;
+            }
+            value = *src++ != 0;
+            return true;
+        case TYPE_DOUBLE:
+            if (left < sizeof(double)) {
+                return false;
+            }
+            value = ValueCodec::LoadFixed<double>(src);
+            src += sizeof(double);
+            return true;
+        default: {
+            uint64_t len = 0;
+            if (!ValueCodec::GetVarint(src, end, len) || len > static_cast<uint64_t>(end - src)) {
+                return false;
+            }
+            if (type == TYPE_STRING) {
+                value.emplace<std::string>(reinterpret_cast<const char *>(src), len);
+            } else {
+                value.emplace<std::vector<uint8_t>>(src, src + len);
+            }
+            src += len;
+            return true;
+        }
+    }
+}
+} // namespace OHOS::ObjectStore
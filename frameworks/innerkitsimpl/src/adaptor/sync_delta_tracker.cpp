@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sync_delta_tracker.h"
+
+namespace OHOS::ObjectStore {
+void SyncDeltaTracker::OnWritten(const std::map<std::string, std::vector<uint8_t>> &entries)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &[key, value] : entries) {
+        entries_.insert_or_assign(key, Entry{ ++seq_, key.size() + value.size() });
+    }
+}
+
+SyncDeltaTracker::Delta SyncDeltaTracker::GetPending(const std::vector<std::string> &deviceIds)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Delta delta;
+    delta.seq = seq_;
+    for (const auto &deviceId : deviceIds) {
+        auto it = acked_.find(deviceId);
+        uint64_t acked = it == acked_.end() ? 0 : it->second;
+        if (acked >= seq_) {
+            continue;
+        }
+        for (const auto &[key, entry] : entries_) {
+            if (entry.seq > acked) {
+                delta.entries++;
+                delta.bytes += entry.bytes;
+            }
+        }
+    }
+    return delta;
+}
+
+void SyncDeltaTracker::OnPushed(const Delta &delta)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.pushCount++;
+    stats_.entryCount += delta.entries;
+    stats_.byteCount += delta.bytes;
+    stats_.lastEntryCount = delta.entries;
+    stats_.lastByteCount = delta.bytes;
+}
+
+void SyncDeltaTracker::OnPulled()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.pullCount++;
+}
+
+void SyncDeltaTracker::Acknowledge(const std::string &deviceId, uint64_t seq)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t &acked = acked_[deviceId];
+    if (seq > acked) {
+        acked = seq;
+    }
+}
+
+SyncStats SyncDeltaTracker::GetStats()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+} // namespace OHOS::ObjectStore
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sync_scheduler.h"
+
+#include <algorithm>
+
+#include "anonymous.h"
+#include "logger.h"
+#include "objectstore_errors.h"
+
+namespace OHOS::ObjectStore {
+std::shared_ptr<SyncScheduler> SyncScheduler::GetInstance()
+{
+    static std::shared_ptr<SyncScheduler> instance = std::make_shared<SyncScheduler>();
+    return instance;
+}
+
+SyncScheduler::SyncScheduler(size_t maxPerDevice, uint32_t retryDelay, uint32_t timeout)
+    : maxPerDevice_(std::max<size_t>(maxPerDevice, 1)), retryDelay_(retryDelay), timeout_(timeout),
+      random_(std::random_device()())
+{
+}
+
+std::shared_ptr<ExecutorPool> SyncScheduler::GetExecutor()
+{
+    std::lock_guard<std::mutex> lock(executorMutex_);
+    if (executor_ == nullptr) {
+        executor_ = std::make_shared<ExecutorPool>(MAX_THREADS, MIN_THREADS, "OBJECT_SYNC");
+    }
+    return executor_;
+}
+
+void SyncScheduler::Submit(const std::string &storeId, const std::string &deviceId, Priority priority, Task task)
+{
+    if (task == nullptr || priority >= PRIORITY_BUTT) {
+        LOG_ERROR("invalid sync request, priority:%{public}d", priority);
+        return;
+    }
+    Request request;
+    request.storeId = storeId;
+    request.deviceId = deviceId;
+    request.priority = priority;
+    request.task = std::move(task);
+    Enqueue(std::move(request));
+}
+
+SyncScheduler::Metrics SyncScheduler::GetMetrics()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Metrics metrics = metrics_;
+    metrics.queueDepth = waiting_.size();
+    metrics.running = running_.size();
+    return metrics;
+}
+
+void SyncScheduler::Enqueue(Request request)
+{
+    std::map<uint64_t, Task> runnable;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (request.attempts == 0) {
+            metrics_.submitted++;
+        }
+        if (MergeLocked(request)) {
+            metrics_.deduplicated++;
+            return;
+        }
+        std::string deviceId = request.deviceId;
+        request.enqueued = Clock::now();
+        waiting_.emplace(request.storeId, deviceId);
+        devices_[deviceId].waiting[request.priority].push_back(std::move(request));
+        runnable = TakeRunnableLocked(deviceId);
+    }
+    Start(std::move(runnable));
+}
+
+bool SyncScheduler::MergeLocked(Request &request)
+{
+    if (waiting_.find({ request.storeId, request.deviceId }) == waiting_.end()) {
+        return false;
+    }
+    auto &device = devices_[request.deviceId];
+    for (uint8_t priority = PRIORITY_HIGH; priority < PRIORITY_BUTT; priority++) {
+        auto &queue = device.waiting[priority];
+        auto it = std::find_if(queue.begin(), queue.end(),
+            [&request](const Request &waiting) { return waiting.storeId == request.storeId; });
+        if (it == queue.end()) {
+            continue;
+        }
+        // The newer task carries the newer callbacks, the waiting request keeps its place unless it moves up.
+        it->task = std::move(request.task);
+        if (request.priority < priority) {
+            Request merged = std::move(*it);
+            queue.erase(it);
+            merged.priority = request.priority;
+            device.waiting[request.priority].push_back(std::move(merged));
+        }
+        return true;
+    }
+    return false;
+}
+
+std::map<uint64_t, SyncScheduler::Task> SyncScheduler::TakeRunnableLocked(const std::string &deviceId)
+{
+    std::map<uint64_t, Task> runnable;
+    auto it = devices_.find(deviceId);
+    if (it == devices_.end()) {
+        return runnable;
+    }
+    auto &device = it->second;
+    auto now = Clock::now();
+    bool empty = true;
+    for (auto &queue : device.waiting) {
+        while (device.running < maxPerDevice_ && !queue.empty()) {
+            Request request = std::move(queue.front());
+            queue.pop_front();
+            waiting_.erase({ request.storeId, request.deviceId });
+            uint64_t wait = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(now - request.enqueued).count());
+            metrics_.started++;
+            metrics_.totalWaitMs += wait;
+            metrics_.maxWaitMs = std::max(metrics_.maxWaitMs, wait);
+            device.running++;
+            uint64_t runId = ++nextRunId_;
+            runnable.emplace(runId, request.task);
+            running_.emplace(runId, Running{ std::move(request), Executor::INVALID_TASK_ID });
+        }
+        empty = empty && queue.empty();
+    }
+    if (empty && device.running == 0) {
+        devices_.erase(it);
+    }
+    return runnable;
+}
+
+void SyncScheduler::Start(std::map<uint64_t, Task> runnable)
+{
+    if (runnable.empty()) {
+        return;
+    }
+    auto executor = GetExecutor();
+    std::weak_ptr<SyncScheduler> weakScheduler = weak_from_this();
+    for (auto &[runId, task] : runnable) {
+        auto timeoutTask = executor->Schedule(std::chrono::milliseconds(timeout_), [weakScheduler, runId]() {
+            auto scheduler = weakScheduler.lock();
+            if (scheduler != nullptr) {
+                scheduler->OnTimeout(runId);
+            }
+        });
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = running_.find(runId);
+            if (it != running_.end() && !it->second.timedOut) {
+                it->second.timeoutTask = timeoutTask;
+            }
+        }
+        executor->Execute([weakScheduler, runId, task = std::move(task)]() {
+            auto scheduler = weakScheduler.lock();
+            if (scheduler == nullptr) {
+                return;
+            }
+            Done done = [weakScheduler, runId](bool succeeded) {
+                auto scheduler = weakScheduler.lock();
+                if (scheduler != nullptr) {
+                    scheduler->Finish(runId, succeeded, true);
+                }
+            };
+            if (task(done) != SUCCESS) {
+                scheduler->Finish(runId, false, false);
+            }
+        });
+    }
+}
+
+void SyncScheduler::Finish(uint64_t runId, bool succeeded, bool retry)
+{
+    std::map<uint64_t, Task> runnable;
+    Executor::TaskId timeoutTask = Executor::INVALID_TASK_ID;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = running_.find(runId);
+        if (it == running_.end()) {
+            // Finished already, by the sync it was waiting for or given up after its second timeout.
+            return;
+        }
+        Request request = std::move(it->second.request);
+        timeoutTask = it->second.timeoutTask;
+        running_.erase(it);
+        std::string deviceId = request.deviceId;
+        devices_[deviceId].running--;
+        if (!succeeded && retry && request.attempts < MAX_RETRIES) {
+            metrics_.retried++;
+            RetryLocked(std::move(request));
+        } else if (!succeeded) {
+            metrics_.failed++;
+            LOG_ERROR("sync %{public}s with %{public}s failed, attempts:%{public}u",
+                Anonymous::Change(request.storeId).c_str(), Anonymous::Change(deviceId).c_str(),
+                request.attempts + 1);
+        }
+        runnable = TakeRunnableLocked(deviceId);
+    }
+    if (timeoutTask != Executor::INVALID_TASK_ID) {
+        GetExecutor()->Remove(timeoutTask);
+    }
+    Start(std::move(runnable));
+}
+
+void SyncScheduler::OnTimeout(uint64_t runId)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = running_.find(runId);
+        if (it == running_.end()) {
+            return;
+        }
+        auto &running = it->second;
+        if (!running.timedOut) {
+            // The sync may still be running in DistributedDB, freeing its slot or retrying it now would put a
+            // second sync with the device on top of it. It completes or times out once more.
+            running.timedOut = true;
+            metrics_.timedOut++;
+            LOG_ERROR("sync %{public}s with %{public}s timed out, waiting for it to complete",
+                Anonymous::Change(running.request.storeId).c_str(),
+                Anonymous::Change(running.request.deviceId).c_str());
+            std::weak_ptr<SyncScheduler> weakScheduler = weak_from_this();
+            running.timeoutTask = GetExecutor()->Schedule(std::chrono::milliseconds(timeout_),
+                [weakScheduler, runId]() {
+                    auto scheduler = weakScheduler.lock();
+                    if (scheduler != nullptr) {
+                        scheduler->OnTimeout(runId);
+                    }
+                });
+            return;
+        }
+    }
+    // Its completion is lost, given up without a retry so that the device is not blocked for good.
+    Finish(runId, false, false);
+}
+
+void SyncScheduler::RetryLocked(Request request)
+{
+    // Half of the backoff is fixed and half random, so retries of many stores spread out over time.
+    uint32_t delay = retryDelay_ << request.attempts;
+    delay = std::uniform_int_distribution<uint32_t>(delay / 2, delay)(random_);
+    request.attempts++;
+    std::weak_ptr<SyncScheduler> weakScheduler = weak_from_this();
+    GetExecutor()->Schedule(std::chrono::milliseconds(delay),
+        [weakScheduler, request = std::move(request)]() mutable {
+            auto scheduler = weakScheduler.lock();
+            if (scheduler != nullptr) {
+                scheduler->Enqueue(std::move(request));
+            }
+        });
+}
+} // namespace OHOS::ObjectStore
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "value_cache.h"
+
+namespace OHOS::ObjectStore {
+ValueCache::ValueCache(size_t capacity) : capacity_(capacity)
+{
+}
+
+bool ValueCache::Get(const std::string &sessionId, const std::string &key, DecodedValue &value)
+{
+    auto cached = Get(sessionId, key);
+    if (cached == nullptr) {
+        return false;
+    }
+    value = *cached;
+    return true;
+}
+
+std::shared_ptr<const DecodedValue> ValueCache::Get(const std::string &sessionId, const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = sessions_.find(sessionId);
+    if (session != sessions_.end()) {
+        auto iter = session->second.find(key);
+        if (iter != session->second.end()) {
+            lru_.splice(lru_.begin(), lru_, iter->second.lru);
+            hits_++;
+            return iter->second.value;
+        }
+    }
+    misses_++;
+    return nullptr;
+}
+
+void ValueCache::Put(
+    const std::string &sessionId, const std::string &key, const DecodedValue &value, uint64_t generation)
+{
+    Put(sessionId, { { key, value } }, generation);
+}
+
+void ValueCache::Put(const std::string &sessionId, const std::vector<std::pair<std::string, DecodedValue>> &values,
+    uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool fresh = generation == generation_;
+    generation_++;
+    if (fresh) {
+        for (const auto &[key, value] : values) {
+            InsertLocked(sessionId, key, std::make_shared<const DecodedValue>(value));
+        }
+        return;
+    }
+    auto session = sessions_.find(sessionId);
+    if (session == sessions_.end()) {
+        return;
+    }
+    for (const auto &item : values) {
+        EraseLocked(session->second, item.first);
+    }
+    if (session->second.empty()) {
+        sessions_.erase(session);
+    }
+}
+
+void ValueCache::Fill(
+    const std::string &sessionId, const std::string &key, const DecodedValue &value, uint64_t generation)
+{
+    Fill(sessionId, key, std::make_shared<const DecodedValue>(value), generation);
+}
+
+void ValueCache::Fill(const std::string &sessionId, const std::string &key,
+    std::shared_ptr<const DecodedValue> value, uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (generation != generation_ || value == nullptr) {
+        return;
+    }
+    InsertLocked(sessionId, key, std::move(value));
+}
+
+void ValueCache::Invalidate(const std::string &sessionId, const std::vector<std::string> &keys)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    generation_++;
+    auto session = sessions_.find(sessionId);
+    if (session == sessions_.end()) {
+        return;
+    }
+    for (auto &key : keys) {
+        EraseLocked(session->second, key);
+    }
+    if (session->second.empty()) {
+        sessions_.erase(session);
+    }
+}
+
+void ValueCache::Invalidate(const std::string &sessionId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    generation_++;
+    auto session = sessions_.find(sessionId);
+    if (session == sessions_.end()) {
+        return;
+    }
+    for (auto &[key, entry] : session->second) {
+        size_ -= entry.size;
+        lru_.erase(entry.lru);
+    }
+    sessions_.erase(session);
+}
+
+uint64_t ValueCache::GetGeneration()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return generation_;
+}
+
+uint64_t ValueCache::GetHitCount() const
+{
+    return hits_;
+}
+
+uint64_t ValueCache::GetMissCount() const
+{
+    return misses_;
+}
+
+size_t ValueCache::GetSize()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+}
+
+size_t ValueCache::SizeOf(const std::string &key, const DecodedValue &value)
+{
+    size_t size = ENTRY_OVERHEAD + key.size();
+    if (auto str = std::get_if<std::string>(&value)) {
+        size += str->size();
+    } else if (auto bytes = std::get_if<std::vector<uint8_t>>(&value)) {
+        size += bytes->size();
+    }
+    return size;
+}
+
+void ValueCache::InsertLocked(
+    const std::string &sessionId, const std::string &key, std::shared_ptr<const DecodedValue> value)
+{
+    auto &entries = sessions_[sessionId];
+    EraseLocked(entries, key);
+    size_t size = SizeOf(key, *value);
+    if (size > capacity_) {
+        return;
+    }
+    while (size_ + size > capacity_ && !lru_.empty()) {
+        auto [victimSession, victimKey] = lru_.back();
+        auto victim = sessions_.find(victimSession);
+        if (victim == sessions_.end() || victim->second.count(victimKey) == 0) {
+            lru_.pop_back();
+            continue;
+        }
+        EraseLocked(victim->second, victimKey);
+    }
+    lru_.emplace_front(sessionId, key);
+    entries.insert_or_assign(key, Entry { std::move(value), size, lru_.begin() });
+    size_ += size;
+}
+
+void ValueCache::EraseLocked(std::unordered_map<std::string, Entry> &entries, const std::string &key)
+{
+    auto iter = entries.find(key);
+    if (iter == entries.end()) {
+        return;
+    }
+    size_ -= iter->second.size;
+    lru_.erase(iter->second.lru);
+    entries.erase(iter);
+}
+} // namespace OHOS::ObjectStore
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "value_compressor.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "logger.h"
+#include "objectstore_errors.h"
+#include "value_codec.h"
+
+namespace OHOS::ObjectStore {
+namespace {
+constexpr size_t HEADER_LEN = ValueCodec::TAG_LEN + ValueCodec::MAX_VARINT_LEN;
+
+uint32_t Load32(const uint8_t *src)
+{
+    uint32_t value;
+    std::memcpy(&value, src, sizeof(value));
+    return value;
+}
+} // namespace
+
+bool ValueCompressor::IsCompressed(const Bytes &data)
+{
+    return !data.empty() && data[0] == ValueCodec::TAG_COMPRESSED;
+}
+
+bool ValueCompressor::Compress(const Bytes &encoded, Bytes &compressed)
+{
+    size_t len = encoded.size();
+    if (len <= HEADER_LEN + MIN_MATCH || len > MAX_VALUE_LEN) {
+        return false;
+    }
+    // Worst case of incompressible input, one extra length byte per 255 literals plus the token.
+    Bytes result(HEADER_LEN + len + len / LEN_EXTEND + MIN_MATCH);
+    uint8_t *dst = result.data();
+    *dst++ = ValueCodec::TAG_COMPRESSED;
+    for (size_t rest = len; ; rest >>= 7) {
+        if (rest < 0x80) {
+            *dst++ = static_cast<uint8_t>(rest);
+            break;
+        }
+        *dst++ = static_cast<uint8_t>(rest | 0x80);
+    }
+    size_t total = static_cast<size_t>(dst - result.data()) + CompressBlock(encoded.data(), len, dst);
+    if (total >= len) {
+        return false;
+    }
+    result.resize(total);
+    compressed = std::move(result);
+    return true;
+}
+
+uint32_t ValueCompressor::Decompress(const Bytes &compressed, Bytes &encoded)
+{
+    if (!IsCompressed(compressed)) {
+        LOG_ERROR("not compressed, size:%{public}zu", compressed.size());
+        return ERR_DATA_LEN;
+    }
+    const uint8_t *src = compressed.data() + ValueCodec::TAG_LEN;
+    const uint8_t *end = compressed.data() + compressed.size();
+    size_t len = 0;
+    for (uint32_t shift = 0; ; shift += 7) {
+        if (src == end || shift >= sizeof(uint32_t) * 8) {
+            LOG_ERROR("bad compressed length, size:%{public}zu", compressed.size());
+            return ERR_DATA_LEN;
+        }
+        len |= static_cast<size_t>(*src & 0x7F) << shift;
+        if ((*src++ & 0x80) == 0) {
+            break;
+        }
+    }
+    if (len == 0 || len > MAX_VALUE_LEN) {
+        LOG_ERROR("bad compressed length %{public}zu", len);
+        return ERR_DATA_LEN;
+    }
+    Bytes result(len);
+    if (!DecompressBlock(src, static_cast<size_t>(end - src), result)) {
+        LOG_ERROR("corrupted block, expect:%{public}zu", len);
+        return ERR_DATA_LEN;
+    }
+    encoded = std::move(result);
+    return SUCCESS;
+}
+
+uint8_t *ValueCompressor::PutLength(uint8_t *dst, size_t len)
+{
+    for (; len >= LEN_EXTEND; len -= LEN_EXTEND) {
+        *dst++ = LEN_EXTEND;
+    }
+    *dst++ = static_cast<uint8_t>(len);
+    return dst;
+}
+
+bool ValueCompressor::GetLength(const uint8_t *&src, const uint8_t *end, size_t &len)
+{
+    uint8_t byte = LEN_EXTEND;
+    while (byte == LEN_EXTEND) {
+        if (src == end || len > MAX_VALUE_LEN) {
+            return false;
+        }
+        byte = *src++;
+        len += byte;
+    }
+    return true;
+}
+
+size_t ValueCompressor::CompressBlock(const uint8_t *src, size_t len, uint8_t *dst)
+{
+    // Positions are stored plus one, zero marks an empty slot.
+    std::vector<uint32_t> table(1u << HASH_BITS, 0);
+    uint8_t *out = dst;
+    size_t anchor = 0;
+    size_t pos = 0;
+    auto emit = [&out, src](size_t litStart, size_t litLen, size_t offset, size_t matchLen) {
+        uint8_t *token = out++;
+        *token = static_cast<uint8_t>(std::min<size_t>(litLen, RUN_MASK) << 4);
+        if (litLen >= RUN_MASK) {
+            out = PutLength(out, litLen - RUN_MASK);
+        }
+        std::memcpy(out, src + litStart, litLen);
+        out += litLen;
+        if (matchLen == 0) {
+            return;
+        }
+        *out++ = static_cast<uint8_t>(offset);
+        *out++ = static_cast<uint8_t>(offset >> 8);
+        size_t extra = matchLen - MIN_MATCH;
+        *token |= static_cast<uint8_t>(std::min<size_t>(extra, RUN_MASK));
+        if (extra >= RUN_MASK) {
+            out = PutLength(out, extra - RUN_MASK);
+        }
+    };
+    while (pos + MIN_MATCH <= len) {
+        uint32_t sequence = Load32(src + pos);
+        uint32_t hash = (sequence * 2654435761u) >> (32 - HASH_BITS);
+        size_t candidate = table[hash];
+        table[hash] = static_cast<uint32_t>(pos + 1);
+        if (candidate == 0 || pos - (candidate - 1) > MAX_OFFSET || Load32(src + candidate - 1) != sequence) {
+            // Step faster through data that keeps missing, incompressible input costs little.
+            pos += 1 + ((pos - anchor) >> 6);
+            continue;
+        }
+        size_t ref = candidate - 1;
+        size_t matchLen = MIN_MATCH;
+        while (pos + matchLen < len && src[ref + matchLen] == src[pos + matchLen]) {
+            matchLen++;
+        }
+        emit(anchor, pos - anchor, pos - ref, matchLen);
+        pos += matchLen;
+        anchor = pos;
+    }
+    emit(anchor, len - anchor, 0, 0);
+    return static_cast<size_t>(out - dst);
+}
+
+bool ValueCompressor::DecompressBlock(const uint8_t *src, size_t len, Bytes &dst)
+{
+    const uint8_t *end = src + len;
+    uint8_t *out = dst.data();
+    uint8_t *outEnd = out + dst.size();
+    while (src < end) {
+        uint8_t token = *src++;
+        size_t litLen = token >> 4;
+        if (litLen == RUN_MASK && !GetLength(src, end, litLen)) {
+            return false;
+        }
+        if (litLen > static_cast<size_t>(end - src) || litLen > static_cast<size_t>(outEnd - out)) {
+            return false;
+        }
+        std::memcpy(out, src, litLen);
+        out += litLen;
+        src += litLen;
+        if (src == end) {
+            return out == outEnd;
+        }
+        if (end - src < 2) {
+            return false;
+        }
+        size_t offset = static_cast<size_t>(src[0]) | (static_cast<size_t>(src[1]) << 8);
+        src += 2;
+        size_t matchLen = token & RUN_MASK;
+        if (matchLen == RUN_MASK && !GetLength(src, end, matchLen)) {
+            return false;
+        }
+        matchLen += MIN_MATCH;
+        if (offset == 0 || offset > static_cast<size_t>(out - dst.data()) ||
+            matchLen > static_cast<size_t>(outEnd - out)) {
+            return false;
+        }
+        const uint8_t *ref = out - offset;
+        if (offset >= matchLen) {
+            std::memcpy(out, ref, matchLen);
+            out += matchLen;
+            continue;
+        }
+        // An overlapping match repeats the bytes it produces, copy them one by one.
+        for (size_t i = 0; i < matchLen; i++) {
+            *out++ = ref[i];
+        }
+    }
+    return false;
+}
+} // namespace OHOS::ObjectStore
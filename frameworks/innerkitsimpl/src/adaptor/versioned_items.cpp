@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "versioned_items.h"
+
+#include "logger.h"
+
+namespace OHOS::ObjectStore {
+std::atomic<size_t> VersionedItems::sharedBytes_ = 0;
+
+ItemSnapshot::Item ItemSnapshot::Find(const std::string &key) const
+{
+    auto it = delta.find(key);
+    if (it != delta.end()) {
+        return it->second;
+    }
+    auto baseIt = base->find(key);
+    return baseIt == base->end() ? nullptr : baseIt->second;
+}
+
+void ItemSnapshot::ForEach(const Visitor &visitor) const
+{
+    auto baseIt = base->begin();
+    auto deltaIt = delta.begin();
+    while (baseIt != base->end() || deltaIt != delta.end()) {
+        const std::string *key = nullptr;
+        const std::vector<uint8_t> *value = nullptr;
+        if (deltaIt == delta.end() || (baseIt != base->end() && baseIt->first < deltaIt->first)) {
+            key = &baseIt->first;
+            value = baseIt->second.get();
+            ++baseIt;
+        } else {
+            if (baseIt != base->end() && baseIt->first == deltaIt->first) {
+                ++baseIt;
+            }
+            key = &deltaIt->first;
+            value = deltaIt->second.get();
+            ++deltaIt;
+        }
+        if (value != nullptr && !visitor(*key, *value)) {
+            return;
+        }
+    }
+}
+
+VersionedItems::VersionedItems(bool bounded) : bounded_(bounded)
+{
+}
+
+VersionedItems::~VersionedItems()
+{
+    ChargeLocked(0);
+}
+
+VersionedItems::Snapshot VersionedItems::Get() const
+{
+    return std::atomic_load(&current_);
+}
+
+uint64_t VersionedItems::GetVersion() const
+{
+    return version_.load();
+}
+
+bool VersionedItems::IsDropped()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return loaded_ && current_ == nullptr;
+}
+
+void VersionedItems::Load(std::map<std::string, std::vector<uint8_t>> items)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (loaded_) {
+        return;
+    }
+    loaded_ = true;
+    for (auto &[key, value] : pending_) {
+        if (value.has_value()) {
+            items.insert_or_assign(key, std::move(*value));
+        } else {
+            items.erase(key);
+        }
+    }
+    pending_.clear();
+    LoadLocked(std::move(items));
+}
+
+bool VersionedItems::CanReload()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return overBudget_ && sharedBytes_.load() + droppedBytes_ <= MAX_SHARED_BYTES;
+}
+
+bool VersionedItems::Reload(std::map<std::string, std::vector<uint8_t>> items)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!overBudget_) {
+        return false;
+    }
+    LoadLocked(std::move(items));
+    return current_ != nullptr;
+}
+
+void VersionedItems::LoadLocked(std::map<std::string, std::vector<uint8_t>> items)
+{
+    auto snapshot = std::make_shared<ItemSnapshot>();
+    snapshot->version = version_.load();
+    auto base = std::make_shared<ItemSnapshot::Items>();
+    for (auto &[key, value] : items) {
+        snapshot->bytes += key.size() + value.size();
+        base->emplace(key, std::make_shared<const std::vector<uint8_t>>(std::move(value)));
+    }
+    snapshot->size = base->size();
+    snapshot->base = std::move(base);
+    if (!ChargeLocked(snapshot->bytes)) {
+        DropOverBudgetLocked(snapshot->bytes);
+        return;
+    }
+    overBudget_ = false;
+    std::atomic_store(&current_, Snapshot(std::move(snapshot)));
+}
+
+void VersionedItems::Put(const std::string &key, const std::vector<uint8_t> &value)
+{
+    Put(std::map<std::string, std::vector<uint8_t>>{ { key, value } });
+}
+
+void VersionedItems::Put(const std::map<std::string, std::vector<uint8_t>> &upserted,
+    const std::vector<std::string> &deleted)
+{
+    if (upserted.empty() && deleted.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    version_++;
+    if (loaded_) {
+        PublishLocked(upserted, deleted);
+        return;
+    }
+    for (const auto &key : deleted) {
+        pending_.insert_or_assign(key, std::nullopt);
+    }
+    for (const auto &[key, value] : upserted) {
+        pending_.insert_or_assign(key, value);
+    }
+}
+
+void VersionedItems::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    version_++;
+    DropLocked();
+}
+
+void VersionedItems::PublishLocked(const std::map<std::string, std::vector<uint8_t>> &upserted,
+    const std::vector<std::string> &deleted)
+{
+    Snapshot current = std::atomic_load(&current_);
+    if (current == nullptr) {
+        return;
+    }
+    // The base and the values that did not change stay shared with older snapshots, only the delta is copied.
+    auto snapshot = std::make_shared<ItemSnapshot>(*current);
+    snapshot->version = version_.load();
+    for (const auto &key : deleted) {
+        auto old = snapshot->Find(key);
+        if (old == nullptr) {
+            continue;
+        }
+        snapshot->size--;
+        snapshot->bytes -= key.size() + old->size();
+        if (snapshot->base->count(key) != 0) {
+            snapshot->delta.insert_or_assign(key, nullptr);
+        } else {
+            snapshot->delta.erase(key);
+        }
+    }
+    for (const auto &[key, value] : upserted) {
+        auto old = snapshot->Find(key);
+        if (old == nullptr) {
+            snapshot->size++;
+            snapshot->bytes += key.size();
+        } else {
+            snapshot->bytes -= old->size();
+        }
+        snapshot->bytes += value.size();
+        snapshot->delta.insert_or_assign(key, std::make_shared<const std::vector<uint8_t>>(value));
+    }
+    CompactIfNeeded(*snapshot);
+    if (!ChargeLocked(snapshot->bytes)) {
+        DropOverBudgetLocked(snapshot->bytes);
+        return;
+    }
+    std::atomic_store(&current_, Snapshot(std::move(snapshot)));
+}
+
+void VersionedItems::CompactIfNeeded(ItemSnapshot &snapshot)
+{
+    // Rebuilding costs the whole base and happens every sqrt(base) writes, which bounds each write to about
+    // sqrt(size) copies instead of one copy of every item.
+    size_t deltaSize = snapshot.delta.size();
+    if (deltaSize <= MIN_DELTA_SIZE || deltaSize * deltaSize <= snapshot.base->size()) {
+        return;
+    }
+    auto base = std::make_shared<ItemSnapshot::Items>(*snapshot.base);
+    for (auto &[key, value] : snapshot.delta) {
+        if (value == nullptr) {
+            base->erase(key);
+        } else {
+            base->insert_or_assign(key, std::move(value));
+        }
+    }
+    snapshot.base = std::move(base);
+    snapshot.delta.clear();
+}
+
+bool VersionedItems::ChargeLocked(size_t bytes)
+{
+    if (!bounded_) {
+        return true;
+    }
+    if (bytes > charged_) {
+        size_t grown = bytes - charged_;
+        if (sharedBytes_.fetch_add(grown) + grown > MAX_SHARED_BYTES) {
+            sharedBytes_.fetch_sub(grown);
+            LOG_INFO("item snapshots of %{public}zu bytes dropped, over the shared budget", bytes);
+            return false;
+        }
+    } else {
+        sharedBytes_.fetch_sub(charged_ - bytes);
+    }
+    charged_ = bytes;
+    return true;
+}
+
+void VersionedItems::DropLocked()
+{
+    ChargeLocked(0);
+    loaded_ = true;
+    overBudget_ = false;
+    pending_.clear();
+    std::atomic_store(&current_, Snapshot());
+}
+
+void VersionedItems::DropOverBudgetLocked(size_t bytes)
+{
+    DropLocked();
+    overBudget_ = true;
+    droppedBytes_ = bytes;
+}
+} // namespace OHOS::ObjectStore
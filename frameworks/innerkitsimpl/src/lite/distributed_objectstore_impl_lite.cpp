@@ -36,9 +36,29 @@ DistributedObject *DistributedObjectStoreImpl::CreateObject(const std::string &s
 
 DistributedObject *DistributedObjectStoreImpl::CreateObject(const std::string &sessionId, uint32_t &status)
 {
+    status = ERR_NULL_OBJECT;
     return nullptr;
 }
 
+DistributedObject *DistributedObjectStoreImpl::CreateObject(
+    const std::string &sessionId, StorageType storageType, uint32_t &status)
+{
+    status = ERR_NULL_OBJECT;
+    return nullptr;
+}
+
+void DistributedObjectStoreImpl::CreateObjectAsync(const std::string &sessionId, const CreateCallback &callback)
+{
+    if (callback) {
+        callback(nullptr, ERR_NULL_OBJECT);
+    }
+}
+
+uint32_t DistributedObjectStoreImpl::PrepareObject(const std::string &sessionId)
+{
+    return ERR_NULL_OBJECT;
+}
+
 uint32_t DistributedObjectStoreImpl::DeleteObject(const std::string &sessionId)
 {
     return ERR_NULL_OBJECT;
@@ -78,4 +98,9 @@ void DistributedObjectStoreImpl::NotifyProgressStatus(const std::string &session
 {
     return;
 }
+
+void DistributedObjectStoreImpl::SetCompressThreshold(size_t threshold)
+{
+    return;
+}
 } // namespace OHOS::ObjectStore
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include "object_service_proxy.h"
 
 #include <logger.h>
+#include "ipc_types.h"
 #include "log_print.h"
 #include "objectstore_errors.h"
 #include "object_types_util.h"
@@ -59,6 +60,43 @@ int32_t ObjectServiceProxy::ObjectStoreSave(const std::string &bundleName, const
     return reply.ReadInt32();
 }
 
+int32_t ObjectServiceProxy::ObjectStoreSaveDelta(const std::string &bundleName, const std::string &sessionId,
+    const std::string &deviceId, const std::map<std::string, std::vector<uint8_t>> &objectData,
+    sptr<IRemoteObject> callback)
+{
+    if (deltaUnsupported_.load()) {
+        return ERR_IPC;
+    }
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(ObjectServiceProxy::GetDescriptor())) {
+        ZLOGE("write descriptor failed");
+        return ERR_IPC;
+    }
+    if (!ITypesUtil::Marshal(data, bundleName, sessionId, deviceId, objectData, callback)) {
+        ZLOGE("Marshalling failed, bundleName = %{public}s", bundleName.c_str());
+        return ERR_IPC;
+    }
+    MessageParcel reply;
+    MessageOption mo { MessageOption::TF_SYNC };
+    sptr<IRemoteObject> remoteObject = Remote();
+    if (remoteObject == nullptr) {
+        ZLOGE("ObjectStoreSaveDelta remoteObject is nullptr.");
+        return ERR_IPC;
+    }
+    int32_t error =
+        remoteObject->SendRequest(static_cast<uint32_t>(ObjectCode::OBJECTSTORE_SAVE_DELTA), data, reply, mo);
+    if (error == IPC_STUB_UNKNOW_TRANS_ERR) {
+        ZLOGE("SendRequest returned %{public}d, delta save is off for this service", error);
+        deltaUnsupported_.store(true);
+        return ERR_IPC;
+    }
+    if (error != 0) {
+        ZLOGE("SendRequest returned %{public}d", error);
+        return ERR_IPC;
+    }
+    return reply.ReadInt32();
+}
+
 int32_t ObjectServiceProxy::OnAssetChanged(const std::string &bundleName, const std::string &sessionId,
     const std::string &deviceId, const Asset &assetValue)
 {
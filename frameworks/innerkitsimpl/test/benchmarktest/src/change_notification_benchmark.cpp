@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "bytes.h"
+#include "distributed_object_impl.h"
+#include "distributed_objectstore_impl.h"
+#include "string_utils.h"
+
+using namespace OHOS::ObjectStore;
+
+namespace {
+constexpr int KEY_COUNT = 10000;
+constexpr int ASSET_INTERVAL = 10;
+constexpr size_t VALUE_SIZE = 32;
+const std::string SESSION_ID = "benchmarkSession";
+
+class ChangedData : public DistributedDB::KvStoreChangedData {
+public:
+    ChangedData()
+    {
+        std::vector<uint8_t> value(VALUE_SIZE, 1);
+        for (int i = 0; i < KEY_COUNT; ++i) {
+            // Every tenth pair of fields is an asset reporting its modify time and size together.
+            std::string key = FIELDS_PREFIX;
+            if (i % ASSET_INTERVAL == 0) {
+                key += "asset" + std::to_string(i) + MODIFY_TIME_SUFFIX;
+            } else if (i % ASSET_INTERVAL == 1) {
+                key += "asset" + std::to_string(i - 1) + SIZE_SUFFIX;
+            } else {
+                key += "field" + std::to_string(i);
+            }
+            auto &entries = (i % 2 == 0) ? inserted_ : updated_;
+            entries.push_back({ StringUtils::StrToBytes(key), value });
+        }
+    }
+    const std::list<DistributedDB::Entry> &GetEntriesInserted() const override
+    {
+        return inserted_;
+    }
+    const std::list<DistributedDB::Entry> &GetEntriesUpdated() const override
+    {
+        return updated_;
+    }
+    const std::list<DistributedDB::Entry> &GetEntriesDeleted() const override
+    {
+        return deleted_;
+    }
+
+private:
+    std::list<DistributedDB::Entry> inserted_;
+    std::list<DistributedDB::Entry> updated_;
+    std::list<DistributedDB::Entry> deleted_;
+};
+
+class CountingWatcher : public ObjectWatcher {
+public:
+    void OnChanged(const std::string &sessionId, const std::vector<std::string> &changedData) override
+    {
+        count += changedData.size();
+    }
+    size_t count = 0;
+};
+
+const ChangedData &GetChangedData()
+{
+    static ChangedData data;
+    return data;
+}
+
+/**
+ * The notification path before classification: entries copied by value, keys converted and
+ * stripped into new strings, then scanned a second time for asset sub-fields.
+ */
+void BM_CopyingChangePipeline(benchmark::State &state)
+{
+    const auto &data = GetChangedData();
+    CountingWatcher watcher;
+    for (auto _ : state) {
+        std::vector<std::string> changedData;
+        for (const auto *entries : { &data.GetEntriesInserted(), &data.GetEntriesUpdated() }) {
+            for (DistributedDB::Entry item : *entries) {
+                std::string tmp = StringUtils::BytesToStr(item.key);
+                if (tmp.compare(0, FIELDS_PREFIX_LEN, FIELDS_PREFIX) == 0) {
+                    changedData.push_back(tmp.substr(FIELDS_PREFIX_LEN));
+                }
+            }
+        }
+        std::unordered_set<std::string> transferKeys;
+        std::vector<std::string> otherKeys;
+        for (const auto &str : changedData) {
+            auto dotPos = str.find(ASSET_DOT);
+            if (dotPos == std::string::npos) {
+                if (str != DEVICEID_KEY) {
+                    otherKeys.push_back(str);
+                }
+            } else if (str.substr(dotPos) == MODIFY_TIME_SUFFIX || str.substr(dotPos) == SIZE_SUFFIX) {
+                transferKeys.insert(str.substr(0, dotPos));
+            }
+        }
+        watcher.OnChanged(SESSION_ID, otherKeys);
+        benchmark::DoNotOptimize(transferKeys);
+    }
+    state.SetItemsProcessed(state.iterations() * KEY_COUNT);
+}
+
+/**
+ * The same change set delivered through Watcher::OnChange and WatcherProxy, keys are only
+ * copied when they reach the public ObjectWatcher.
+ */
+void BM_ClassifiedChangePipeline(benchmark::State &state)
+{
+    const auto &data = GetChangedData();
+    auto watcher = std::make_shared<CountingWatcher>();
+    WatcherProxy proxy(watcher, SESSION_ID);
+    for (auto _ : state) {
+        proxy.OnChange(data);
+    }
+    benchmark::DoNotOptimize(watcher->count);
+    state.SetItemsProcessed(state.iterations() * KEY_COUNT);
+}
+
+/**
+ * Classification alone with one reused ChangedKeys, which allocates nothing after the first round.
+ */
+void BM_ClassifyReused(benchmark::State &state)
+{
+    const auto &data = GetChangedData();
+    ChangedKeys changedKeys;
+    for (auto _ : state) {
+        changedKeys.Clear();
+        for (const auto *entries : { &data.GetEntriesInserted(), &data.GetEntriesUpdated() }) {
+            for (const auto &entry : *entries) {
+                changedKeys.AddStoredKey(
+                    std::string_view(reinterpret_cast<const char *>(entry.key.data()), entry.key.size()));
+            }
+        }
+        changedKeys.Finish();
+        benchmark::DoNotOptimize(changedKeys.GetFields().data());
+    }
+    state.SetItemsProcessed(state.iterations() * KEY_COUNT);
+}
+} // namespace
+
+BENCHMARK(BM_CopyingChangePipeline);
+BENCHMARK(BM_ClassifiedChangePipeline);
+BENCHMARK(BM_ClassifyReused);
+
+BENCHMARK_MAIN();
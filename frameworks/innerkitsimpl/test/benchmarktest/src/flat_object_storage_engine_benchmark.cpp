@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "distributed_object.h"
+#include "flat_object_storage_engine.h"
+#include "memory_object_storage_engine.h"
+#include "objectstore_errors.h"
+
+using namespace OHOS::ObjectStore;
+
+namespace {
+constexpr int MAX_THREADS = 8;
+constexpr int KEY_COUNT = 64;
+const std::string BUNDLE_NAME = "com.example.benchmark";
+const std::string SESSION_PREFIX = "benchmarkSession";
+
+// state.range(0) selects the engine, so both backends run the same workload.
+std::shared_ptr<ObjectStorageEngine> GetEngine(int64_t storageType)
+{
+    static std::shared_ptr<ObjectStorageEngine> engines[STORAGE_MEMORY + 1];
+    static std::once_flag flags[STORAGE_MEMORY + 1];
+    std::call_once(flags[storageType], [storageType]() {
+        auto &engine = engines[storageType];
+        if (storageType == STORAGE_MEMORY) {
+            engine = std::make_shared<MemoryObjectStorageEngine>();
+        } else {
+            engine = std::make_shared<FlatObjectStorageEngine>();
+        }
+        engine->Open(BUNDLE_NAME);
+        std::vector<uint8_t> value(16, 1);
+        for (int i = 0; i < MAX_THREADS; ++i) {
+            std::string sessionId = SESSION_PREFIX + std::to_string(i);
+            engine->CreateTable(sessionId);
+            for (int k = 0; k < KEY_COUNT; ++k) {
+                engine->UpdateItem(sessionId, "p_key" + std::to_string(k), value);
+            }
+            engine->Flush(sessionId);
+        }
+    });
+    return engines[storageType];
+}
+
+/**
+ * Every thread reads and writes its own session. With per-session locking the throughput
+ * reported with UseRealTime should grow close to linearly with the thread count.
+ */
+void BM_IndependentSessions(benchmark::State &state)
+{
+    auto engine = GetEngine(state.range(0));
+    std::string sessionId = SESSION_PREFIX + std::to_string(state.thread_index() % MAX_THREADS);
+    std::vector<uint8_t> value(16, 2);
+    std::vector<uint8_t> result;
+    int index = 0;
+    for (auto _ : state) {
+        std::string key = "p_key" + std::to_string(index++ % KEY_COUNT);
+        engine->GetItem(sessionId, key, result);
+        engine->UpdateItem(sessionId, key, value);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * One thread scans a whole session while the others read their own sessions, the scan
+ * must not stall the readers.
+ */
+void BM_ReadWhileScanning(benchmark::State &state)
+{
+    auto engine = GetEngine(state.range(0));
+    std::vector<uint8_t> result;
+    std::map<std::string, std::vector<uint8_t>> items;
+    std::string sessionId = SESSION_PREFIX + std::to_string(state.thread_index() % MAX_THREADS);
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            items.clear();
+            engine->GetItems(sessionId, items);
+            benchmark::DoNotOptimize(items);
+        } else {
+            engine->GetItem(sessionId, "p_key0", result);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(BM_IndependentSessions)->Arg(STORAGE_DISTRIBUTED)->Arg(STORAGE_MEMORY)
+    ->ThreadRange(1, MAX_THREADS)->UseRealTime();
+BENCHMARK(BM_ReadWhileScanning)->Arg(STORAGE_DISTRIBUTED)->Arg(STORAGE_MEMORY)
+    ->ThreadRange(2, MAX_THREADS)->UseRealTime();
+
+BENCHMARK_MAIN();
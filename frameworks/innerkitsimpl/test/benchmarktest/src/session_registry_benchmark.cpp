@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "distributed_object_impl.h"
+#include "distributed_objectstore_impl.h"
+
+using namespace OHOS::ObjectStore;
+
+namespace {
+constexpr int64_t MIN_SESSIONS = 10;
+constexpr int64_t MAX_SESSIONS = 100000;
+constexpr int64_t MULTIPLIER = 10;
+constexpr int THREADS = 4;
+
+std::vector<std::string> MakeSessionIds(int64_t count)
+{
+    std::vector<std::string> sessionIds;
+    sessionIds.reserve(count);
+    for (int64_t i = 0; i < count; ++i) {
+        sessionIds.push_back("benchmarkSession" + std::to_string(i));
+    }
+    return sessionIds;
+}
+
+// Lookup as DistributedObjectStoreImpl did before the registry was hashed.
+class LegacyRegistry {
+public:
+    explicit LegacyRegistry(const std::vector<std::string> &sessionIds)
+    {
+        for (const auto &sessionId : sessionIds) {
+            objects_.push_back(new DistributedObjectImpl(sessionId, nullptr));
+        }
+    }
+    ~LegacyRegistry()
+    {
+        for (auto object : objects_) {
+            delete object;
+        }
+    }
+    DistributedObject *Get(const std::string &sessionId)
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        for (auto object : objects_) {
+            if (object->GetSessionId() == sessionId) {
+                return object;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    std::shared_mutex mutex_;
+    std::vector<DistributedObject *> objects_;
+};
+
+std::unique_ptr<DistributedObjectStoreImpl> MakeStore(const std::vector<std::string> &sessionIds)
+{
+    auto store = std::make_unique<DistributedObjectStoreImpl>(nullptr);
+    for (const auto &sessionId : sessionIds) {
+        store->CacheObject(sessionId, nullptr);
+    }
+    return store;
+}
+
+// Shared by the threads of one run, built by the first thread to get here.
+DistributedObjectStoreImpl &GetSharedStore(int64_t count, std::vector<std::string> &sessionIds)
+{
+    static std::mutex mutex;
+    static std::map<int64_t, std::pair<std::vector<std::string>, std::unique_ptr<DistributedObjectStoreImpl>>> stores;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &entry = stores[count];
+    if (entry.second == nullptr) {
+        entry.first = MakeSessionIds(count);
+        entry.second = MakeStore(entry.first);
+    }
+    sessionIds = entry.first;
+    return *entry.second;
+}
+
+void BM_LegacyGet(benchmark::State &state)
+{
+    auto sessionIds = MakeSessionIds(state.range(0));
+    LegacyRegistry registry(sessionIds);
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(registry.Get(sessionIds[index]));
+        index = (index + 1) % sessionIds.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_RegistryGet(benchmark::State &state)
+{
+    auto sessionIds = MakeSessionIds(state.range(0));
+    auto store = MakeStore(sessionIds);
+    size_t index = 0;
+    for (auto _ : state) {
+        DistributedObject *object = nullptr;
+        store->Get(sessionIds[index], &object);
+        benchmark::DoNotOptimize(object);
+        index = (index + 1) % sessionIds.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_RegistryGetThreaded(benchmark::State &state)
+{
+    std::vector<std::string> sessionIds;
+    auto &store = GetSharedStore(state.range(0), sessionIds);
+    size_t index = static_cast<size_t>(state.thread_index()) % sessionIds.size();
+    for (auto _ : state) {
+        DistributedObject *object = nullptr;
+        store.Get(sessionIds[index], &object);
+        benchmark::DoNotOptimize(object);
+        index = (index + 1) % sessionIds.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_RegistryCreateRemove(benchmark::State &state)
+{
+    auto sessionIds = MakeSessionIds(state.range(0));
+    auto store = MakeStore(sessionIds);
+    const std::string sessionId = "benchmarkSessionExtra";
+    for (auto _ : state) {
+        store->CacheObject(sessionId, nullptr);
+        store->RemoveCacheObject(sessionId);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(BM_LegacyGet)->RangeMultiplier(MULTIPLIER)->Range(MIN_SESSIONS, MAX_SESSIONS);
+BENCHMARK(BM_RegistryGet)->RangeMultiplier(MULTIPLIER)->Range(MIN_SESSIONS, MAX_SESSIONS);
+BENCHMARK(BM_RegistryGetThreaded)->RangeMultiplier(MULTIPLIER)->Range(MIN_SESSIONS, MAX_SESSIONS)->Threads(THREADS);
+BENCHMARK(BM_RegistryCreateRemove)->RangeMultiplier(MULTIPLIER)->Range(MIN_SESSIONS, MAX_SESSIONS);
+
+BENCHMARK_MAIN();
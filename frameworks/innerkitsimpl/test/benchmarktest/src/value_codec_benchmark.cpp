@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "bytes.h"
+#include "bytes_utils.h"
+#include "string_utils.h"
+#include "value_codec.h"
+
+using namespace OHOS::ObjectStore;
+
+namespace {
+constexpr int64_t MIN_STRING_LEN = 8;
+constexpr int64_t MAX_STRING_LEN = 4096;
+constexpr double SALARY = 100.5;
+
+// Encoding as FlatObjectStore did before ValueCodec.
+Bytes LegacyEncodeDouble(double value)
+{
+    Bytes data;
+    Type type = TYPE_DOUBLE;
+    BytesUtils::PutNum(&type, 0, sizeof(type), data);
+    BytesUtils::PutNum(&value, sizeof(type), sizeof(value), data);
+    return data;
+}
+
+Bytes LegacyEncodeString(const std::string &value)
+{
+    Bytes data;
+    Type type = TYPE_STRING;
+    BytesUtils::PutNum(&type, 0, sizeof(type), data);
+    Bytes dst = StringUtils::StrToBytes(value);
+    data.insert(data.end(), dst.begin(), dst.end());
+    return data;
+}
+
+void BM_LegacyEncodeDouble(benchmark::State &state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LegacyEncodeDouble(SALARY));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_CodecEncodeDouble(benchmark::State &state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ValueCodec::EncodeDouble(SALARY));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_LegacyDecodeDouble(benchmark::State &state)
+{
+    Bytes data = LegacyEncodeDouble(SALARY);
+    for (auto _ : state) {
+        Type type = TYPE_STRING;
+        double value = 0;
+        BytesUtils::GetNum(data, 0, &type, sizeof(type));
+        BytesUtils::GetNum(data, sizeof(type), &value, sizeof(value));
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_CodecDecodeDouble(benchmark::State &state)
+{
+    Bytes data = ValueCodec::EncodeDouble(SALARY);
+    for (auto _ : state) {
+        double value = 0;
+        ValueCodec::DecodeDouble(data, value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_LegacyEncodeString(benchmark::State &state)
+{
+    std::string value(state.range(0), 'a');
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LegacyEncodeString(value));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CodecEncodeString(benchmark::State &state)
+{
+    std::string value(state.range(0), 'a');
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ValueCodec::EncodeString(value));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_LegacyDecodeString(benchmark::State &state)
+{
+    Bytes data = LegacyEncodeString(std::string(state.range(0), 'a'));
+    for (auto _ : state) {
+        std::string value;
+        StringUtils::BytesToStrWithType(data, value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CodecDecodeString(benchmark::State &state)
+{
+    Bytes data = ValueCodec::EncodeString(std::string(state.range(0), 'a'));
+    for (auto _ : state) {
+        std::string_view value;
+        ValueCodec::DecodeString(data, value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CodecVarint(benchmark::State &state)
+{
+    int64_t number = state.range(0);
+    for (auto _ : state) {
+        int64_t value = 0;
+        ValueCodec::DecodeVarint(ValueCodec::EncodeVarint(number), value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(BM_LegacyEncodeDouble);
+BENCHMARK(BM_CodecEncodeDouble);
+BENCHMARK(BM_LegacyDecodeDouble);
+BENCHMARK(BM_CodecDecodeDouble);
+BENCHMARK(BM_LegacyEncodeString)->Range(MIN_STRING_LEN, MAX_STRING_LEN);
+BENCHMARK(BM_CodecEncodeString)->Range(MIN_STRING_LEN, MAX_STRING_LEN);
+BENCHMARK(BM_LegacyDecodeString)->Range(MIN_STRING_LEN, MAX_STRING_LEN);
+BENCHMARK(BM_CodecDecodeString)->Range(MIN_STRING_LEN, MAX_STRING_LEN);
+BENCHMARK(BM_CodecVarint)->Arg(1)->Arg(-300)->Arg(INT64_MAX);
+
+BENCHMARK_MAIN();
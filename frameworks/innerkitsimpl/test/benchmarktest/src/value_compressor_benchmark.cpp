@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bytes.h"
+#include "value_codec.h"
+#include "value_compressor.h"
+
+using namespace OHOS::ObjectStore;
+
+namespace {
+constexpr int64_t MIN_VALUE_LEN = 1024;
+constexpr int64_t MAX_VALUE_LEN = 1024 * 1024;
+constexpr int64_t JSON_DOCUMENT = 0;
+constexpr int64_t THUMBNAIL = 1;
+
+// JSON documents repeat their keys, thumbnails are already compressed and look like random bytes.
+Bytes MakeValue(int64_t kind, size_t len)
+{
+    std::mt19937 random(len);
+    if (kind == THUMBNAIL) {
+        Bytes thumbnail(len);
+        for (auto &byte : thumbnail) {
+            byte = static_cast<uint8_t>(random());
+        }
+        return ValueCodec::EncodeComplex(thumbnail);
+    }
+    std::string document = "[";
+    while (document.size() < len) {
+        document += "{\"name\":\"user" + std::to_string(random() % 1000) + "\",\"age\":" +
+            std::to_string(random() % 100) + ",\"online\":" + (random() % 2 == 0 ? "true" : "false") + "},";
+    }
+    document.resize(len);
+    return ValueCodec::EncodeString(document);
+}
+
+void BM_Compress(benchmark::State &state)
+{
+    Bytes value = MakeValue(state.range(0), state.range(1));
+    Bytes compressed;
+    bool isCompressed = false;
+    for (auto _ : state) {
+        isCompressed = ValueCompressor::Compress(value, compressed);
+        benchmark::DoNotOptimize(compressed);
+    }
+    size_t stored = isCompressed ? compressed.size() : value.size();
+    state.counters["ratio"] = static_cast<double>(value.size()) / stored;
+    state.SetBytesProcessed(state.iterations() * value.size());
+}
+
+void BM_Decompress(benchmark::State &state)
+{
+    Bytes value = MakeValue(state.range(0), state.range(1));
+    Bytes compressed;
+    if (!ValueCompressor::Compress(value, compressed)) {
+        state.SkipWithError("value is not compressible");
+        return;
+    }
+    for (auto _ : state) {
+        Bytes restored;
+        ValueCompressor::Decompress(compressed, restored);
+        benchmark::DoNotOptimize(restored);
+    }
+    state.SetBytesProcessed(state.iterations() * value.size());
+}
+} // namespace
+
+BENCHMARK(BM_Compress)->ArgsProduct({ { JSON_DOCUMENT, THUMBNAIL },
+    benchmark::CreateRange(MIN_VALUE_LEN, MAX_VALUE_LEN, 32) });
+BENCHMARK(BM_Decompress)->ArgsProduct({ { JSON_DOCUMENT }, benchmark::CreateRange(MIN_VALUE_LEN, MAX_VALUE_LEN, 32) });
+
+BENCHMARK_MAIN();
@@ -21,6 +21,7 @@
 #include "iservice_registry.h"
 #include "itypes_util.h"
 #include "logger.h"
+#include "object_service_proxy.h"
 #include "objectstore_errors.h"
 
 using namespace testing::ext;
@@ -74,6 +75,29 @@ HWTEST_F(ClientAdaptorTest, OnRemoteDied_001, TestSize.Level1)
     EXPECT_EQ(clientAdaptor.distributedDataMgr_, nullptr);
 }
 
+/**
+ * @tc.name: GetObjectService_001
+ * @tc.desc: Test the looked up object service is reused until the data service dies
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClientAdaptorTest, GetObjectService_001, TestSize.Level1)
+{
+    sptr<IRemoteObject> impl = sptr<IPCObjectStub>(new (std::nothrow) IPCObjectStub());
+    ASSERT_NE(impl, nullptr);
+    sptr<DistributedObject::IObjectService> service = new (std::nothrow) DistributedObject::ObjectServiceProxy(impl);
+    ASSERT_NE(service, nullptr);
+    ClientAdaptor::objectService_ = std::make_shared<sptr<DistributedObject::IObjectService>>(service);
+    uint64_t lookups = ClientAdaptor::GetLookupCount();
+    EXPECT_EQ(ClientAdaptor::GetObjectService(), service);
+    EXPECT_EQ(ClientAdaptor::GetObjectService(), service);
+    EXPECT_EQ(ClientAdaptor::GetLookupCount(), lookups);
+
+    wptr<IRemoteObject> remote = nullptr;
+    ClientAdaptor::ServiceDeathRecipient serviceDeathRecipient;
+    serviceDeathRecipient.OnRemoteDied(remote);
+    EXPECT_EQ(ClientAdaptor::objectService_, nullptr);
+}
+
 /**
  * @tc.name: RegisterClientDeathListener_001
  * @tc.desc: Abnormal test for RegisterClientDeathListener, remoteObject is nullptr
@@ -28,6 +28,7 @@
 #include "accesstoken_kit.h"
 #include "nativetoken_kit.h"
 #include "token_setproc.h"
+#include "typed_object.h"
 
 using namespace testing::ext;
 using namespace OHOS::ObjectStore;
@@ -200,23 +201,23 @@ HWTEST_F(DistributedObjectImplTest, GetAssetValue_001, TestSize.Level1)
 
 /**
  * @tc.name: RemovePrefix_001
- * @tc.desc: Test RemovePrefix function
+ * @tc.desc: Test the prefix of asset sub-fields is removed when the asset is read
  * @tc.type: FUNC
  */
 HWTEST_F(DistributedObjectImplTest, RemovePrefix_001, TestSize.Level1)
 {
-    Asset assetValue;
-    assetValue.name = "[STRING]test.txt";
-    assetValue.uri = "[STRING]file://test.txt";
-    assetValue.path = "[STRING]/test/test.txt";
-    assetValue.createTime = "[STRING]2024-01-01 00:00:00";
-    assetValue.modifyTime = "[STRING]2024-01-01 00:00:01";
-    assetValue.size = "[STRING]1024";
-    
+    string assetKey = "assetKeyRemovePrefix";
     flatObjectStore_->CreateObject("sessionIdRemovePrefix");
     DistributedObjectImpl distributedObjectImpl("sessionIdRemovePrefix", flatObjectStore_);
-    distributedObjectImpl.RemovePrefix(assetValue);
-    
+    distributedObjectImpl.PutString(assetKey + NAME_SUFFIX, "[STRING]test.txt");
+    distributedObjectImpl.PutString(assetKey + URI_SUFFIX, "[STRING]file://test.txt");
+    distributedObjectImpl.PutString(assetKey + PATH_SUFFIX, "[STRING]/test/test.txt");
+    distributedObjectImpl.PutString(assetKey + CREATE_TIME_SUFFIX, "[STRING]2024-01-01 00:00:00");
+    distributedObjectImpl.PutString(assetKey + MODIFY_TIME_SUFFIX, "[STRING]2024-01-01 00:00:01");
+    distributedObjectImpl.PutString(assetKey + SIZE_SUFFIX, "[STRING]1024");
+
+    Asset assetValue;
+    ASSERT_EQ(distributedObjectImpl.GetAssetValue(assetKey, assetValue), SUCCESS);
     EXPECT_EQ(assetValue.name, "test.txt");
     EXPECT_EQ(assetValue.uri, "file://test.txt");
     EXPECT_EQ(assetValue.path, "/test/test.txt");
@@ -246,4 +247,75 @@ HWTEST_F(DistributedObjectImplTest, BindAssetStore_002, TestSize.Level1)
     auto ret = distributedObjectImpl.BindAssetStore(assetKey, bindInfo);
     EXPECT_NE(ret, SUCCESS);
 }
-}
\ No newline at end of file
+
+/**
+ * @tc.name: TypedPutGet_001
+ * @tc.desc: Put and get values through the compile-time typed layer
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectImplTest, TypedPutGet_001, TestSize.Level1)
+{
+    string sessionId = "sessionIdTypedPutGet";
+    ASSERT_EQ(flatObjectStore_->CreateObject(sessionId, STORAGE_MEMORY), SUCCESS);
+    DistributedObjectImpl object(sessionId, flatObjectStore_);
+    struct Point {
+        int32_t x;
+        int32_t y;
+    };
+    static_assert(FieldTraits<Point>::TYPE == TYPE_COMPLEX);
+    static_assert(FieldTraits<uint16_t>::TYPE == TYPE_DOUBLE);
+    EXPECT_EQ(ObjectStore::Put(object, "point", Point{ 3, -4 }), SUCCESS);
+    Point point{};
+    EXPECT_EQ(ObjectStore::Get(object, "point", point), SUCCESS);
+    EXPECT_EQ(point.x, 3);
+    EXPECT_EQ(point.y, -4);
+
+    EXPECT_EQ(ObjectStore::Put(object, "name", "Tom"), SUCCESS);
+    EXPECT_EQ(ObjectStore::Put(object, "title", std::string_view("Mr")), SUCCESS);
+    std::string name;
+    EXPECT_EQ(ObjectStore::Get(object, "name", name), SUCCESS);
+    EXPECT_EQ(name, "Tom");
+    EXPECT_EQ(ObjectStore::Get(object, "title", name), SUCCESS);
+    EXPECT_EQ(name, "Mr");
+
+    EXPECT_EQ(ObjectStore::Put(object, "age", 28), SUCCESS);
+    EXPECT_EQ(ObjectStore::Put(object, "score", 2.5), SUCCESS);
+    int64_t age = 0;
+    EXPECT_EQ(ObjectStore::Get(object, "age", age), SUCCESS);
+    EXPECT_EQ(age, 28);
+    uint8_t small = 0;
+    EXPECT_EQ(ObjectStore::Get(object, "score", small), ERR_DATA_LEN);
+    EXPECT_EQ(ObjectStore::Put(object, "married", true), SUCCESS);
+    bool married = false;
+    EXPECT_EQ(ObjectStore::Get(object, "married", married), SUCCESS);
+    EXPECT_TRUE(married);
+    EXPECT_EQ(ObjectStore::Get(object, "name", point), ERR_DATA_LEN);
+    EXPECT_EQ(flatObjectStore_->Delete(sessionId), SUCCESS);
+}
+
+/**
+ * @tc.name: PutBatch_001
+ * @tc.desc: Test a batch with asset sub-fields writes the device id with them and one without does not
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectImplTest, PutBatch_001, TestSize.Level1)
+{
+    string sessionId = "sessionIdPutBatch001";
+    flatObjectStore_->CreateObject(sessionId);
+    DistributedObjectImpl distributedObjectImpl(sessionId, flatObjectStore_);
+    std::string deviceId;
+    EXPECT_EQ(distributedObjectImpl.PutBatch({ { "name", std::string("[STRING]Tom") }, { "age", 28.0 } }), SUCCESS);
+    EXPECT_NE(distributedObjectImpl.GetString(DEVICEID_KEY, deviceId), SUCCESS);
+
+    std::map<std::string, FieldValue> values = {
+        { "attachment.uri", std::string("[STRING]file://test.txt") },
+        { "attachment.size", std::string("[STRING]1024") },
+    };
+    EXPECT_EQ(distributedObjectImpl.PutBatch(values), SUCCESS);
+    EXPECT_EQ(distributedObjectImpl.GetString(DEVICEID_KEY, deviceId), SUCCESS);
+    std::string uri;
+    EXPECT_EQ(distributedObjectImpl.GetString("attachment.uri", uri), SUCCESS);
+    EXPECT_EQ(uri, "[STRING]file://test.txt");
+    EXPECT_EQ(flatObjectStore_->Delete(sessionId), SUCCESS);
+}
+}
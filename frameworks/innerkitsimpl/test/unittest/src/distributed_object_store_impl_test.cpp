@@ -82,18 +82,15 @@ HWTEST_F(DistributedObjectStoreImplTest, OnChanged_001, TestSize.Level0)
 }
 
 /**
- * @tc.name: FindChangedAssetKey_001
- * @tc.desc: Abnormal test for FindChangedAssetKey, changedKey.size() is less than MODIFY_TIME_SUFFIX
+ * @tc.name: ChangedKeys_002
+ * @tc.desc: Abnormal test for ChangedKeys, a field ending with a dot is not an asset
  * @tc.type: FUNC
  */
-HWTEST_F(DistributedObjectStoreImplTest, FindChangedAssetKey_001, TestSize.Level0)
+HWTEST_F(DistributedObjectStoreImplTest, ChangedKeys_002, TestSize.Level0)
 {
-    string changedKey = "sessionId.";
-    string assetKey = "assetKey";
-    std::shared_ptr<MockObjectWatcher> objectWatcher = std::make_shared<MockObjectWatcher>();
-    WatcherProxy watcherProxy(objectWatcher, changedKey);
-    bool ret = watcherProxy.FindChangedAssetKey(changedKey, assetKey);
-    EXPECT_EQ(ret, false);
+    ChangedKeys changedKeys;
+    changedKeys.AddField("sessionId.");
+    EXPECT_TRUE(changedKeys.GetAssets().empty());
 }
 
 /**
@@ -142,6 +139,30 @@ HWTEST_F(DistributedObjectStoreImplTest, RemoveCacheObject_001, TestSize.Level1)
     EXPECT_TRUE(storeImpl.objects_.empty());
 }
 
+/**
+ * @tc.name: CacheObject_002
+ * @tc.desc: Test caching a session twice keeps the object handed out first
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, CacheObject_002, TestSize.Level1)
+{
+    string sessionId = "sessionId";
+    std::string bundleName = "default";
+    FlatObjectStore *flatObjectStore = new FlatObjectStore(bundleName);
+    DistributedObjectStoreImpl storeImpl(flatObjectStore);
+    auto first = storeImpl.CacheObject(sessionId, flatObjectStore);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(storeImpl.CacheObject(sessionId, flatObjectStore), first);
+    EXPECT_NE(storeImpl.CacheObject("otherSessionId", flatObjectStore), first);
+    DistributedObject *object = nullptr;
+    EXPECT_EQ(storeImpl.Get(sessionId, &object), SUCCESS);
+    EXPECT_EQ(object, first);
+    storeImpl.RemoveCacheObject(sessionId);
+    EXPECT_EQ(storeImpl.Get(sessionId, &object), ERR_GET_OBJECT);
+    EXPECT_EQ(storeImpl.objects_.size(), 1);
+    storeImpl.RemoveCacheObject("otherSessionId");
+}
+
 /**
  * @tc.name: CreateObject_001
  * @tc.desc: Test CreateObject with null flatObjectStore_
@@ -320,35 +341,31 @@ HWTEST_F(DistributedObjectStoreImplTest, OnChanged_003, TestSize.Level1)
 }
 
 /**
- * @tc.name: FindChangedAssetKey_002
- * @tc.desc: Test FindChangedAssetKey with MODIFY_TIME_SUFFIX
+ * @tc.name: ChangedKeys_003
+ * @tc.desc: Test ChangedKeys with MODIFY_TIME_SUFFIX
  * @tc.type: FUNC
  */
-HWTEST_F(DistributedObjectStoreImplTest, FindChangedAssetKey_002, TestSize.Level1)
+HWTEST_F(DistributedObjectStoreImplTest, ChangedKeys_003, TestSize.Level1)
 {
-    string changedKey = "asset.modifyTime";
-    string assetKey;
-    std::shared_ptr<MockObjectWatcher> objectWatcher = std::make_shared<MockObjectWatcher>();
-    WatcherProxy watcherProxy(objectWatcher, "sessionId");
-    bool ret = watcherProxy.FindChangedAssetKey(changedKey, assetKey);
-    EXPECT_TRUE(ret);
-    EXPECT_EQ(assetKey, "asset");
+    ChangedKeys changedKeys;
+    changedKeys.AddField("asset.modifyTime");
+    ASSERT_EQ(changedKeys.GetAssets().size(), 1);
+    EXPECT_EQ(changedKeys.GetAssets()[0], "asset");
+    EXPECT_TRUE(changedKeys.GetFields().empty());
 }
 
 /**
- * @tc.name: FindChangedAssetKey_003
- * @tc.desc: Test FindChangedAssetKey with SIZE_SUFFIX
+ * @tc.name: ChangedKeys_004
+ * @tc.desc: Test ChangedKeys with SIZE_SUFFIX
  * @tc.type: FUNC
  */
-HWTEST_F(DistributedObjectStoreImplTest, FindChangedAssetKey_003, TestSize.Level1)
+HWTEST_F(DistributedObjectStoreImplTest, ChangedKeys_004, TestSize.Level1)
 {
-    string changedKey = "asset.size";
-    string assetKey;
-    std::shared_ptr<MockObjectWatcher> objectWatcher = std::make_shared<MockObjectWatcher>();
-    WatcherProxy watcherProxy(objectWatcher, "sessionId");
-    bool ret = watcherProxy.FindChangedAssetKey(changedKey, assetKey);
-    EXPECT_TRUE(ret);
-    EXPECT_EQ(assetKey, "asset");
+    ChangedKeys changedKeys;
+    changedKeys.AddField("asset.size");
+    ASSERT_EQ(changedKeys.GetAssets().size(), 1);
+    EXPECT_EQ(changedKeys.GetAssets()[0], "asset");
+    EXPECT_TRUE(changedKeys.GetFields().empty());
 }
 
 /**
@@ -502,33 +519,27 @@ HWTEST_F(DistributedObjectStoreImplTest, StatusNotifierProxy_OnChanged_004, Test
 }
 
 /**
- * @tc.name: FindChangedAssetKey_004
- * @tc.desc: Test FindChangedAssetKey with empty changedKey
+ * @tc.name: ChangedKeys_005
+ * @tc.desc: Test ChangedKeys with an empty field
  * @tc.type: FUNC
  */
-HWTEST_F(DistributedObjectStoreImplTest, FindChangedAssetKey_004, TestSize.Level1)
+HWTEST_F(DistributedObjectStoreImplTest, ChangedKeys_005, TestSize.Level1)
 {
-    string changedKey = "";
-    string assetKey;
-    std::shared_ptr<MockObjectWatcher> objectWatcher = std::make_shared<MockObjectWatcher>();
-    WatcherProxy watcherProxy(objectWatcher, "sessionId");
-    auto ret = watcherProxy.FindChangedAssetKey(changedKey, assetKey);
-    EXPECT_FALSE(ret);
+    ChangedKeys changedKeys;
+    changedKeys.AddField("");
+    EXPECT_TRUE(changedKeys.GetAssets().empty());
 }
 
 /**
- * @tc.name: FindChangedAssetKey_005
- * @tc.desc: Test FindChangedAssetKey with non-matching suffix
+ * @tc.name: ChangedKeys_006
+ * @tc.desc: Test ChangedKeys with non-matching suffix
  * @tc.type: FUNC
  */
-HWTEST_F(DistributedObjectStoreImplTest, FindChangedAssetKey_005, TestSize.Level1)
+HWTEST_F(DistributedObjectStoreImplTest, ChangedKeys_006, TestSize.Level1)
 {
-    string changedKey = "asset.someOtherSuffix";
-    string assetKey;
-    std::shared_ptr<MockObjectWatcher> objectWatcher = std::make_shared<MockObjectWatcher>();
-    WatcherProxy watcherProxy(objectWatcher, "sessionId");
-    auto ret = watcherProxy.FindChangedAssetKey(changedKey, assetKey);
-    EXPECT_FALSE(ret);
+    ChangedKeys changedKeys;
+    changedKeys.AddField("asset.someOtherSuffix");
+    EXPECT_TRUE(changedKeys.GetAssets().empty());
 }
 
 /**
@@ -572,4 +583,367 @@ HWTEST_F(DistributedObjectStoreImplTest, Get_002, TestSize.Level1)
     auto ret = storeImpl.Get(sessionId, &object);
     EXPECT_EQ(ret, ERR_GET_OBJECT);
 }
+
+/**
+ * @tc.name: ChangedKeys_001
+ * @tc.desc: Test changed keys are classified into fields, assets and the device id
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, ChangedKeys_001, TestSize.Level1)
+{
+    std::vector<std::string> storedKeys = { "p_name", "p_attachment.modifyTime", "p_attachment.size",
+        "p_attachment.uri", "p___deviceId", "other", "r_attachment.record", "r_.schema" };
+    ChangedKeys changedKeys;
+    for (const auto &key : storedKeys) {
+        changedKeys.AddStoredKey(key);
+    }
+    changedKeys.Finish();
+    EXPECT_EQ(changedKeys.GetAll().size(), 5);
+    ASSERT_EQ(changedKeys.GetFields().size(), 1);
+    EXPECT_EQ(changedKeys.GetFields()[0], "name");
+    ASSERT_EQ(changedKeys.GetAssets().size(), 1);
+    EXPECT_EQ(changedKeys.GetAssets()[0], "attachment");
+    EXPECT_TRUE(changedKeys.HasDeviceId());
+    EXPECT_TRUE(changedKeys.HasSchemaRecord());
+
+    changedKeys.Clear();
+    EXPECT_TRUE(changedKeys.Empty());
+    EXPECT_FALSE(changedKeys.HasDeviceId());
+    EXPECT_FALSE(changedKeys.HasSchemaRecord());
+    changedKeys.AddField(".size");
+    EXPECT_TRUE(changedKeys.GetAssets().empty());
+}
+
+class RecordWatcher : public ObjectWatcher {
+public:
+    void OnChanged(const std::string &sessionid, const std::vector<std::string> &changedData) override
+    {
+        changedCount++;
+    }
+    void OnRecordChanged(const std::string &sessionId) override
+    {
+        recordCount++;
+    }
+    int changedCount = 0;
+    int recordCount = 0;
+};
+
+/**
+ * @tc.name: OnRecordChanged_001
+ * @tc.desc: Test a change of the schema record reaches the watcher without a field key
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, OnRecordChanged_001, TestSize.Level1)
+{
+    string sessionId = "sessionId";
+    auto objectWatcher = std::make_shared<RecordWatcher>();
+    WatcherProxy watcherProxy(objectWatcher, sessionId);
+    ChangedKeys changedKeys;
+    changedKeys.AddStoredKey("r_.schema");
+    changedKeys.AddStoredKey("r_attachment.record");
+    changedKeys.Finish();
+    EXPECT_FALSE(changedKeys.Empty());
+    watcherProxy.OnChangedKeys(sessionId, changedKeys, true);
+    EXPECT_EQ(objectWatcher->recordCount, 1);
+    EXPECT_EQ(objectWatcher->changedCount, 0);
+
+    changedKeys.Clear();
+    changedKeys.AddStoredKey("p_name");
+    changedKeys.Finish();
+    watcherProxy.OnChangedKeys(sessionId, changedKeys, true);
+    EXPECT_EQ(objectWatcher->recordCount, 1);
+    EXPECT_EQ(objectWatcher->changedCount, 1);
+}
+
+// Implements only the methods of the first release, as an implementation written before the later ones.
+class LegacyObject : public DistributedObject {
+public:
+    uint32_t PutDouble(const std::string &key, double value) override
+    {
+        return SUCCESS;
+    }
+    uint32_t PutBoolean(const std::string &key, bool value) override
+    {
+        return SUCCESS;
+    }
+    uint32_t PutString(const std::string &key, const std::string &value) override
+    {
+        return SUCCESS;
+    }
+    uint32_t PutComplex(const std::string &key, const std::vector<uint8_t> &value) override
+    {
+        return SUCCESS;
+    }
+    uint32_t GetDouble(const std::string &key, double &value) override
+    {
+        return SUCCESS;
+    }
+    uint32_t GetBoolean(const std::string &key, bool &value) override
+    {
+        return SUCCESS;
+    }
+    uint32_t GetString(const std::string &key, std::string &value) override
+    {
+        return SUCCESS;
+    }
+    uint32_t GetComplex(const std::string &key, std::vector<uint8_t> &value) override
+    {
+        return SUCCESS;
+    }
+    uint32_t GetType(const std::string &key, Type &type) override
+    {
+        return SUCCESS;
+    }
+    uint32_t Save(const std::string &deviceId) override
+    {
+        return SUCCESS;
+    }
+    uint32_t RevokeSave() override
+    {
+        return SUCCESS;
+    }
+    std::string &GetSessionId() override
+    {
+        return sessionId_;
+    }
+    uint32_t BindAssetStore(const std::string &assetKey, AssetBindInfo &bindInfo) override
+    {
+        return SUCCESS;
+    }
+
+private:
+    std::string sessionId_ = "legacy";
+};
+
+class LegacyStore : public DistributedObjectStore {
+public:
+    DistributedObject *CreateObject(const std::string &sessionId) override
+    {
+        return nullptr;
+    }
+    DistributedObject *CreateObject(const std::string &sessionId, uint32_t &status) override
+    {
+        return nullptr;
+    }
+    uint32_t Get(const std::string &sessionId, DistributedObject **object) override
+    {
+        return SUCCESS;
+    }
+    uint32_t DeleteObject(const std::string &sessionId) override
+    {
+        return SUCCESS;
+    }
+    uint32_t Watch(DistributedObject *object, std::shared_ptr<ObjectWatcher> objectWatcher) override
+    {
+        return SUCCESS;
+    }
+    uint32_t UnWatch(DistributedObject *object) override
+    {
+        return SUCCESS;
+    }
+    uint32_t SetStatusNotifier(std::shared_ptr<StatusNotifier> notifier) override
+    {
+        return SUCCESS;
+    }
+    void NotifyCachedStatus(const std::string &sessionId) override
+    {
+    }
+    uint32_t SetProgressNotifier(std::shared_ptr<ProgressNotifier> notifier) override
+    {
+        return SUCCESS;
+    }
+    void NotifyProgressStatus(const std::string &sessionId) override
+    {
+    }
+};
+
+/**
+ * @tc.name: DefaultCreateObjectAsync_001
+ * @tc.desc: Test a store without CreateObjectAsync and PrepareObject reports them unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultCreateObjectAsync_001, TestSize.Level1)
+{
+    LegacyStore legacyStore;
+    DistributedObjectStore &store = legacyStore;
+    uint32_t status = SUCCESS;
+    store.CreateObjectAsync("session", [&status](DistributedObject *created, uint32_t result) { status = result; });
+    EXPECT_EQ(status, ERR_NOT_SUPPORTED);
+    EXPECT_EQ(store.PrepareObject("session"), ERR_NOT_SUPPORTED);
+}
+
+/**
+ * @tc.name: DefaultCreateObject_001
+ * @tc.desc: Test a store without storage types reports CreateObject with a storage type unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultCreateObject_001, TestSize.Level1)
+{
+    LegacyStore legacyStore;
+    DistributedObjectStore &store = legacyStore;
+    uint32_t status = SUCCESS;
+    EXPECT_EQ(store.CreateObject("session", STORAGE_MEMORY, status), nullptr);
+    EXPECT_EQ(status, ERR_NOT_SUPPORTED);
+}
+
+/**
+ * @tc.name: DefaultGetView_001
+ * @tc.desc: Test an object without views reports GetView unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultGetView_001, TestSize.Level1)
+{
+    LegacyObject object;
+    ValueView view;
+    EXPECT_EQ(object.GetView("name", view), ERR_NOT_SUPPORTED);
+    EXPECT_EQ(view.data, nullptr);
+}
+
+/**
+ * @tc.name: DefaultSetCompressThreshold_001
+ * @tc.desc: Test a store without compression accepts SetCompressThreshold
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultSetCompressThreshold_001, TestSize.Level1)
+{
+    LegacyStore legacyStore;
+    DistributedObjectStore &store = legacyStore;
+    store.SetCompressThreshold(0);
+    store.SetCompressThreshold(1024);
+}
+
+/**
+ * @tc.name: DefaultSetSyncPolicy_001
+ * @tc.desc: Test an object without sync policies reports SetSyncPolicy and Commit unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultSetSyncPolicy_001, TestSize.Level1)
+{
+    LegacyObject object;
+    EXPECT_EQ(object.SetSyncPolicy(SYNC_MANUAL, 0), ERR_NOT_SUPPORTED);
+    EXPECT_EQ(object.Commit(), ERR_NOT_SUPPORTED);
+}
+
+/**
+ * @tc.name: DefaultGetSyncStats_001
+ * @tc.desc: Test an object without sync statistics reports GetSyncStats unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultGetSyncStats_001, TestSize.Level1)
+{
+    LegacyObject object;
+    SyncStats stats;
+    EXPECT_EQ(object.GetSyncStats(stats), ERR_NOT_SUPPORTED);
+}
+
+/**
+ * @tc.name: DefaultPutBatch_001
+ * @tc.desc: Test an object without batches reports PutBatch, GetBatch and GetAll unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultPutBatch_001, TestSize.Level1)
+{
+    LegacyObject object;
+    std::map<std::string, FieldValue> values;
+    EXPECT_EQ(object.PutBatch({ { "name", std::string("[STRING]value") } }), ERR_NOT_SUPPORTED);
+    EXPECT_EQ(object.GetBatch({ "name" }, values), ERR_NOT_SUPPORTED);
+    EXPECT_EQ(object.GetAll(values), ERR_NOT_SUPPORTED);
+    EXPECT_TRUE(values.empty());
+}
+
+/**
+ * @tc.name: DefaultGet_001
+ * @tc.desc: Test an object without typed reads reports Get unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultGet_001, TestSize.Level1)
+{
+    LegacyObject object;
+    FieldValue value;
+    EXPECT_EQ(object.Get("name", value), ERR_NOT_SUPPORTED);
+}
+
+/**
+ * @tc.name: DefaultPutAsset_001
+ * @tc.desc: Test an object without asset records reports PutAsset and GetAsset unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultPutAsset_001, TestSize.Level1)
+{
+    LegacyObject object;
+    Asset asset;
+    EXPECT_EQ(object.PutAsset("attachment", asset), ERR_NOT_SUPPORTED);
+    EXPECT_EQ(object.GetAsset("attachment", asset), ERR_NOT_SUPPORTED);
+}
+
+/**
+ * @tc.name: DefaultGetPropertyHandle_001
+ * @tc.desc: Test an object without property handles returns no handle and reports its use unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultGetPropertyHandle_001, TestSize.Level1)
+{
+    LegacyObject object;
+    EXPECT_EQ(object.GetPropertyHandle("name"), nullptr);
+    FieldValue value;
+    PropertyHandle handle = std::make_shared<const PropertyKey>();
+    EXPECT_EQ(object.Put(handle, value), ERR_NOT_SUPPORTED);
+    EXPECT_EQ(object.Get(handle, value), ERR_NOT_SUPPORTED);
+    ValueView view;
+    EXPECT_EQ(object.GetView(handle, view), ERR_NOT_SUPPORTED);
+}
+
+/**
+ * @tc.name: DefaultBindSchema_001
+ * @tc.desc: Test an object without schemas reports BindSchema, PutRecord and GetRecord unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultBindSchema_001, TestSize.Level1)
+{
+    LegacyObject object;
+    EXPECT_EQ(object.BindSchema({ "contact", { TYPE_STRING } }), ERR_NOT_SUPPORTED);
+    SchemaRecord record(1);
+    EXPECT_EQ(object.PutRecord(record), ERR_NOT_SUPPORTED);
+    EXPECT_EQ(object.GetRecord(record), ERR_NOT_SUPPORTED);
+}
+
+/**
+ * @tc.name: DefaultPutView_001
+ * @tc.desc: Test an object without views reports PutView unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultPutView_001, TestSize.Level1)
+{
+    LegacyObject object;
+    std::string payload = "value";
+    ValueView view { TYPE_STRING, nullptr, reinterpret_cast<const uint8_t *>(payload.data()), payload.size() };
+    EXPECT_EQ(object.PutView("name", view), ERR_NOT_SUPPORTED);
+}
+
+/**
+ * @tc.name: DefaultGetVersion_001
+ * @tc.desc: Test an object without versions reports GetVersion unsupported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultGetVersion_001, TestSize.Level1)
+{
+    LegacyObject object;
+    uint64_t version = 0;
+    EXPECT_EQ(object.GetVersion(version), ERR_NOT_SUPPORTED);
+}
+
+/**
+ * @tc.name: DefaultSaveAsync_001
+ * @tc.desc: Test an object without asynchronous saves reports them unsupported and cancels nothing
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedObjectStoreImplTest, DefaultSaveAsync_001, TestSize.Level1)
+{
+    LegacyObject object;
+    SaveId saveId = INVALID_SAVE_ID;
+    EXPECT_EQ(object.SaveAsync("local", DEFAULT_SAVE_TIMEOUT, [](uint32_t) {}, saveId), ERR_NOT_SUPPORTED);
+    EXPECT_EQ(object.RevokeSaveAsync(DEFAULT_SAVE_TIMEOUT, [](uint32_t) {}, saveId), ERR_NOT_SUPPORTED);
+    EXPECT_EQ(saveId, INVALID_SAVE_ID);
+    EXPECT_FALSE(object.CancelSave(saveId));
+}
 }
@@ -19,6 +19,7 @@
 #include "flat_object_store.h"
 
 #include "accesstoken_kit.h"
+#include "asset_codec.h"
 #include "block_data.h"
 #include "bytes_utils.h"
 #include "client_adaptor.h"
@@ -29,8 +30,10 @@
 #include "object_radar_reporter.h"
 #include "object_service_proxy.h"
 #include "objectstore_errors.h"
+#include "schema_codec.h"
 #include "softbus_adapter.h"
 #include "string_utils.h"
+#include "value_compressor.h"
 
 #define OMIT_MULTI_VER
 
@@ -275,4 +278,629 @@ HWTEST_F(FlatObjectStoreTest, RevokeSave_001, TestSize.Level1)
     auto ret = flatObjectStore.RevokeSave(sessionId);
     EXPECT_EQ(ret, ERR_NULL_PTR);
 }
+
+/**
+ * @tc.name: ValueCache_001
+ * @tc.desc: Test repeated reads are served from the value cache and remote changes invalidate it
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, ValueCache_001, TestSize.Level1)
+{
+    string sessionId = "cacheSession";
+    std::string bundleName = "default";
+    FlatObjectStore flatObjectStore(bundleName);
+    ASSERT_EQ(flatObjectStore.storageEngine_->CreateTable(sessionId), SUCCESS);
+    EXPECT_EQ(flatObjectStore.PutDouble(sessionId, "salary", 100.5), SUCCESS);
+    double value = 0;
+    EXPECT_EQ(flatObjectStore.GetDouble(sessionId, "salary", value), SUCCESS);
+    EXPECT_EQ(value, 100.5);
+    Type type = TYPE_STRING;
+    EXPECT_EQ(flatObjectStore.GetType(sessionId, "salary", type), SUCCESS);
+    EXPECT_EQ(type, TYPE_DOUBLE);
+    EXPECT_EQ(flatObjectStore.GetCacheHitCount(), 2);
+    EXPECT_EQ(flatObjectStore.GetCacheMissCount(), 0);
+
+    auto engine = std::static_pointer_cast<FlatObjectStorageEngine>(flatObjectStore.storageEngine_);
+    engine->OnDataChanged(sessionId, { std::string(FIELDS_PREFIX) + "salary" });
+    EXPECT_EQ(flatObjectStore.GetDouble(sessionId, "salary", value), SUCCESS);
+    EXPECT_EQ(value, 100.5);
+    EXPECT_EQ(flatObjectStore.GetCacheMissCount(), 1);
+    EXPECT_EQ(flatObjectStore.GetDouble(sessionId, "salary", value), SUCCESS);
+    EXPECT_EQ(flatObjectStore.GetCacheHitCount(), 3);
+
+    std::string str;
+    EXPECT_EQ(flatObjectStore.GetString(sessionId, "salary", str), ERR_DATA_LEN);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+    EXPECT_EQ(flatObjectStore.valueCache_->GetSize(), 0);
+}
+
+/**
+ * @tc.name: Executor_001
+ * @tc.desc: Test opens and device queries run on a pool of their own, apart from the flush timers
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, Executor_001, TestSize.Level1)
+{
+    FlatObjectStore flatObjectStore("default");
+    auto engine = std::static_pointer_cast<FlatObjectStorageEngine>(flatObjectStore.storageEngine_);
+    ASSERT_NE(engine, nullptr);
+    auto executor = engine->GetExecutor();
+    ASSERT_NE(executor, nullptr);
+    EXPECT_EQ(engine->GetExecutor(), executor);
+    auto openExecutor = engine->GetOpenExecutor();
+    ASSERT_NE(openExecutor, nullptr);
+    EXPECT_NE(openExecutor, executor);
+    EXPECT_EQ(engine->GetOpenExecutor(), openExecutor);
+}
+
+/**
+ * @tc.name: ValueCache_002
+ * @tc.desc: Test the value cache evicts least recently used entries when over capacity
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, ValueCache_002, TestSize.Level1)
+{
+    ValueCache cache(256);
+    cache.Put("session", "p_a", std::string(100, 'a'), cache.GetGeneration());
+    cache.Put("session", "p_b", std::string(100, 'b'), cache.GetGeneration());
+    DecodedValue value;
+    EXPECT_FALSE(cache.Get("session", "p_a", value));
+    EXPECT_TRUE(cache.Get("session", "p_b", value));
+    EXPECT_LE(cache.GetSize(), 256);
+
+    uint64_t generation = cache.GetGeneration();
+    cache.Invalidate("session", { "p_b" });
+    cache.Fill("session", "p_b", std::string("stale"), generation);
+    EXPECT_FALSE(cache.Get("session", "p_b", value));
+    cache.Fill("session", "p_b", std::string("fresh"), cache.GetGeneration());
+    EXPECT_TRUE(cache.Get("session", "p_b", value));
+    EXPECT_EQ(std::get<std::string>(value), "fresh");
+}
+
+/**
+ * @tc.name: ValueCache_003
+ * @tc.desc: Test a write-through raced by another write or a remote change drops the entries instead
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, ValueCache_003, TestSize.Level1)
+{
+    ValueCache cache;
+    uint64_t first = cache.GetGeneration();
+    uint64_t second = cache.GetGeneration();
+    cache.Put("session", "p_a", std::string("second"), second);
+    cache.Put("session", "p_a", std::string("first"), first);
+    DecodedValue value;
+    EXPECT_FALSE(cache.Get("session", "p_a", value));
+
+    cache.Put("session", { { "p_a", std::string("a") }, { "p_b", std::string("b") } }, cache.GetGeneration());
+    EXPECT_TRUE(cache.Get("session", "p_a", value));
+    EXPECT_TRUE(cache.Get("session", "p_b", value));
+    uint64_t generation = cache.GetGeneration();
+    cache.Invalidate("session", { "p_c" });
+    cache.Put("session", { { "p_a", std::string("local") }, { "p_c", std::string("local") } }, generation);
+    EXPECT_FALSE(cache.Get("session", "p_a", value));
+    EXPECT_FALSE(cache.Get("session", "p_c", value));
+    ASSERT_TRUE(cache.Get("session", "p_b", value));
+    EXPECT_EQ(std::get<std::string>(value), "b");
+}
+
+/**
+ * @tc.name: DirtyKeyTracker_001
+ * @tc.desc: Test dirty keys are only tracked for devices with a saved baseline
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, DirtyKeyTracker_001, TestSize.Level1)
+{
+    DirtyKeyTracker tracker;
+    std::set<std::string> keys;
+    tracker.MarkDirty("session", "p_name");
+    EXPECT_FALSE(tracker.Take("session", "device", keys));
+
+    tracker.ResetBaseline("session", "device");
+    tracker.MarkDirty("session", "p_name");
+    tracker.MarkDirty("session", std::vector<std::string>{ "p_age", "p_name" });
+    EXPECT_TRUE(tracker.Take("session", "device", keys));
+    EXPECT_EQ(keys.size(), 2);
+    EXPECT_TRUE(tracker.Take("session", "device", keys));
+    EXPECT_TRUE(keys.empty());
+
+    tracker.Restore("session", "device", { "p_age" });
+    EXPECT_TRUE(tracker.Take("session", "device", keys));
+    EXPECT_EQ(keys.count("p_age"), 1);
+
+    tracker.DropBaseline("session");
+    EXPECT_FALSE(tracker.Take("session", "device", keys));
+}
+
+/**
+ * @tc.name: Save_002
+ * @tc.desc: Test a failed full save does not leave a baseline behind
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, Save_002, TestSize.Level1)
+{
+    string sessionId = "sessionId2";
+    string deviceId = "deviceId2";
+    std::string bundleName = "default";
+    FlatObjectStore flatObjectStore(bundleName);
+    auto ret = flatObjectStore.Save(sessionId, deviceId);
+    EXPECT_NE(ret, SUCCESS);
+    std::set<std::string> keys;
+    EXPECT_FALSE(flatObjectStore.dirtyKeys_->Take(sessionId, deviceId, keys));
+}
+
+/**
+ * @tc.name: MemoryEngine_001
+ * @tc.desc: Test objects kept in memory, selected per store and per session
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, MemoryEngine_001, TestSize.Level1)
+{
+    string sessionId = "memorySession";
+    std::string bundleName = "default";
+    FlatObjectStore memoryStore(bundleName, STORAGE_MEMORY);
+    ASSERT_EQ(memoryStore.CreateObject(sessionId), SUCCESS);
+    EXPECT_EQ(memoryStore.CreateObject(sessionId), ERR_EXIST);
+    EXPECT_EQ(memoryStore.PutString(sessionId, "name", "Tom"), SUCCESS);
+    std::string name;
+    EXPECT_EQ(memoryStore.GetString(sessionId, "name", name), SUCCESS);
+    EXPECT_EQ(name, "Tom");
+    std::map<std::string, std::vector<uint8_t>> data = { { "p_name", { 1 } }, { "p_age", { 2 } } };
+    memoryStore.FilterData(sessionId, data);
+    EXPECT_EQ(data.size(), 1);
+    EXPECT_EQ(data.count("p_age"), 1);
+    EXPECT_EQ(memoryStore.Delete(sessionId), SUCCESS);
+    EXPECT_EQ(memoryStore.GetString(sessionId, "name", name), ERR_DB_NOT_EXIST);
+
+    FlatObjectStore flatObjectStore(bundleName);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId, STORAGE_MEMORY), SUCCESS);
+    EXPECT_EQ(flatObjectStore.CreateObject(sessionId), ERR_EXIST);
+    EXPECT_EQ(flatObjectStore.PutDouble(sessionId, "salary", 100.5), SUCCESS);
+    double salary = 0;
+    EXPECT_EQ(flatObjectStore.GetDouble(sessionId, "salary", salary), SUCCESS);
+    EXPECT_EQ(salary, 100.5);
+    Bytes value;
+    EXPECT_EQ(flatObjectStore.storageEngine_->GetItem(sessionId, "p_salary", value), ERR_DB_NOT_EXIST);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), ERR_DB_NOT_EXIST);
+
+    uint32_t created = ERR_DB_GET_FAIL;
+    flatObjectStore.CreateObjectAsync(sessionId, STORAGE_MEMORY, [&created](uint32_t status) { created = status; });
+    EXPECT_EQ(created, SUCCESS);
+    flatObjectStore.CreateObjectAsync(sessionId, STORAGE_MEMORY, [&created](uint32_t status) { created = status; });
+    EXPECT_EQ(created, ERR_EXIST);
+    EXPECT_EQ(flatObjectStore.storageEngine_->GetItem(sessionId, "p_salary", value), ERR_DB_NOT_EXIST);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+}
+}
+
+/**
+ * @tc.name: GetView_001
+ * @tc.desc: Test views read the stored value without copying and stay valid after the value changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, GetView_001, TestSize.Level1)
+{
+    string sessionId = "viewSession";
+    FlatObjectStore flatObjectStore("default", STORAGE_MEMORY);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId), SUCCESS);
+    std::vector<uint8_t> bytes = { 1, 2, 3 };
+    EXPECT_EQ(flatObjectStore.PutComplex(sessionId, "data", bytes), SUCCESS);
+    EXPECT_EQ(flatObjectStore.PutString(sessionId, "name", "Tom"), SUCCESS);
+
+    ValueView view;
+    ASSERT_EQ(flatObjectStore.GetView(sessionId, "data", view), SUCCESS);
+    EXPECT_EQ(view.type, TYPE_COMPLEX);
+    ASSERT_EQ(view.size, bytes.size());
+    EXPECT_EQ(std::vector<uint8_t>(view.data, view.data + view.size), bytes);
+    ValueView again;
+    ASSERT_EQ(flatObjectStore.GetView(sessionId, "data", again), SUCCESS);
+    EXPECT_EQ(again.data, view.data);
+
+    EXPECT_EQ(flatObjectStore.PutComplex(sessionId, "data", { 4 }), SUCCESS);
+    EXPECT_EQ(std::vector<uint8_t>(view.data, view.data + view.size), bytes);
+
+    ASSERT_EQ(flatObjectStore.GetView(sessionId, "name", view), SUCCESS);
+    EXPECT_EQ(view.type, TYPE_STRING);
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(view.data), view.size), "Tom");
+    EXPECT_EQ(flatObjectStore.GetView(sessionId, "missing", view), ObjectStorageEngine::ERR_ITEM_NOT_FOUND);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+}
+
+/**
+ * @tc.name: Compression_001
+ * @tc.desc: Test values above the threshold are stored compressed and read back unchanged
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, Compression_001, TestSize.Level1)
+{
+    std::string document;
+    for (int i = 0; i < 100; i++) {
+        document += "{\"name\":\"Tom\",\"age\":" + std::to_string(i) + "},";
+    }
+    string sessionId = "compressSession";
+    FlatObjectStore flatObjectStore("default", STORAGE_MEMORY);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId), SUCCESS);
+    flatObjectStore.SetCompressThreshold(64);
+    EXPECT_EQ(flatObjectStore.PutString(sessionId, "doc", document), SUCCESS);
+    EXPECT_EQ(flatObjectStore.PutString(sessionId, "name", "Tom"), SUCCESS);
+    Bytes stored;
+    EXPECT_EQ(flatObjectStore.storageEngine_->GetItem(sessionId, "p_doc", stored), SUCCESS);
+    EXPECT_TRUE(ValueCompressor::IsCompressed(stored));
+    EXPECT_EQ(flatObjectStore.storageEngine_->GetItem(sessionId, "p_name", stored), SUCCESS);
+    EXPECT_FALSE(ValueCompressor::IsCompressed(stored));
+
+    flatObjectStore.valueCache_->Invalidate(sessionId, { "p_doc" });
+    std::string value;
+    EXPECT_EQ(flatObjectStore.GetString(sessionId, "doc", value), SUCCESS);
+    EXPECT_EQ(value, document);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+}
+
+/**
+ * @tc.name: Compression_002
+ * @tc.desc: Test asset sub-fields, the device id and asset records stay uncompressed above the threshold
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, Compression_002, TestSize.Level1)
+{
+    string sessionId = "compressAssetSession";
+    FlatObjectStore flatObjectStore("default", STORAGE_MEMORY);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId), SUCCESS);
+    flatObjectStore.SetCompressThreshold(16);
+    std::string path = "/data/storage/el2/distributedfiles/dir";
+    for (int i = 0; i < 10; i++) {
+        path += "/dir";
+    }
+    Asset asset;
+    asset.name = "test.txt";
+    asset.uri = "file://com.example.app" + path + "/test.txt";
+    asset.path = path + "/test.txt";
+    asset.modifyTime = "2024-01-01 00:00:01";
+    asset.size = "1024";
+    std::string deviceId(64, 'a');
+    EXPECT_EQ(flatObjectStore.PutAsset(sessionId, "attachment", asset, deviceId), SUCCESS);
+    Bytes stored;
+    EXPECT_EQ(flatObjectStore.Get(sessionId, "p_attachment.path", stored), SUCCESS);
+    EXPECT_GT(stored.size(), path.size());
+    EXPECT_FALSE(ValueCompressor::IsCompressed(stored));
+    EXPECT_EQ(flatObjectStore.Get(sessionId, "p_attachment.uri", stored), SUCCESS);
+    EXPECT_FALSE(ValueCompressor::IsCompressed(stored));
+    EXPECT_EQ(flatObjectStore.Get(sessionId, std::string("p_") + DEVICEID_KEY, stored), SUCCESS);
+    EXPECT_FALSE(ValueCompressor::IsCompressed(stored));
+    EXPECT_EQ(flatObjectStore.Get(sessionId, "r_attachment.record", stored), SUCCESS);
+    EXPECT_FALSE(ValueCompressor::IsCompressed(stored));
+
+    // A sub-field written alone, as the asset sync of an older peer does, is not compressed either.
+    EXPECT_EQ(flatObjectStore.PutString(sessionId, "attachment.path", "[STRING]" + path), SUCCESS);
+    EXPECT_EQ(flatObjectStore.Get(sessionId, "p_attachment.path", stored), SUCCESS);
+    EXPECT_FALSE(ValueCompressor::IsCompressed(stored));
+    EXPECT_EQ(flatObjectStore.PutString(sessionId, "doc", path), SUCCESS);
+    EXPECT_EQ(flatObjectStore.Get(sessionId, "p_doc", stored), SUCCESS);
+    EXPECT_TRUE(ValueCompressor::IsCompressed(stored));
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+}
+
+/**
+ * @tc.name: PutBatch_001
+ * @tc.desc: Test fields of any type are put together and read back by key or all at once
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, PutBatch_001, TestSize.Level1)
+{
+    string sessionId = "batchSession";
+    FlatObjectStore flatObjectStore("default", STORAGE_MEMORY);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId), SUCCESS);
+    std::map<std::string, FieldValue> values = {
+        { "name", std::string("Tom") },
+        { "isTrue", true },
+        { "salary", 100.5 },
+        { "picture", std::vector<uint8_t>{ 1, 2, 3 } },
+    };
+    EXPECT_EQ(flatObjectStore.PutBatch(sessionId, values), SUCCESS);
+    EXPECT_EQ(flatObjectStore.PutBatch(sessionId, {}), ERR_INVALID_ARGS);
+    std::map<std::string, FieldValue> tooMany;
+    for (size_t i = 0; i <= ObjectStore::DistributedObject::MAX_BATCH_SIZE; i++) {
+        tooMany.emplace("field" + std::to_string(i), static_cast<double>(i));
+    }
+    EXPECT_EQ(flatObjectStore.PutBatch(sessionId, tooMany), ERR_INVALID_ARGS);
+
+    std::map<std::string, FieldValue> result;
+    EXPECT_EQ(flatObjectStore.GetBatch(sessionId, { "name", "salary", "missing" }, result), SUCCESS);
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(std::get<std::string>(result["name"]), "Tom");
+    EXPECT_EQ(std::get<double>(result["salary"]), 100.5);
+
+    flatObjectStore.valueCache_->Invalidate(sessionId);
+    result.clear();
+    EXPECT_EQ(flatObjectStore.GetAll(sessionId, result), SUCCESS);
+    EXPECT_EQ(result, values);
+    double salary = 0;
+    EXPECT_EQ(flatObjectStore.GetDouble(sessionId, "salary", salary), SUCCESS);
+    EXPECT_EQ(salary, 100.5);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+}
+
+/**
+ * @tc.name: GetValue_001
+ * @tc.desc: Test one read returns the value of a field together with its type
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, GetValue_001, TestSize.Level1)
+{
+    string sessionId = "getValueSession";
+    FlatObjectStore flatObjectStore("default", STORAGE_MEMORY);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId), SUCCESS);
+    EXPECT_EQ(flatObjectStore.PutString(sessionId, "name", "Tom"), SUCCESS);
+    EXPECT_EQ(flatObjectStore.PutBoolean(sessionId, "isTrue", true), SUCCESS);
+    EXPECT_EQ(flatObjectStore.PutDouble(sessionId, "salary", 100.5), SUCCESS);
+    EXPECT_EQ(flatObjectStore.PutComplex(sessionId, "picture", { 1, 2, 3 }), SUCCESS);
+
+    FieldValue value;
+    EXPECT_EQ(flatObjectStore.GetValue(sessionId, "name", value), SUCCESS);
+    EXPECT_EQ(value.index(), TYPE_STRING);
+    EXPECT_EQ(std::get<std::string>(value), "Tom");
+    EXPECT_EQ(flatObjectStore.GetValue(sessionId, "isTrue", value), SUCCESS);
+    EXPECT_EQ(value.index(), TYPE_BOOLEAN);
+    EXPECT_TRUE(std::get<bool>(value));
+    EXPECT_EQ(flatObjectStore.GetValue(sessionId, "salary", value), SUCCESS);
+    EXPECT_EQ(value.index(), TYPE_DOUBLE);
+    EXPECT_EQ(std::get<double>(value), 100.5);
+    EXPECT_EQ(flatObjectStore.GetValue(sessionId, "picture", value), SUCCESS);
+    EXPECT_EQ(value.index(), TYPE_COMPLEX);
+    EXPECT_EQ(std::get<std::vector<uint8_t>>(value), std::vector<uint8_t>({ 1, 2, 3 }));
+    EXPECT_NE(flatObjectStore.GetValue(sessionId, "missing", value), SUCCESS);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+}
+
+/**
+ * @tc.name: PutAsset_001
+ * @tc.desc: Test an asset is written as one record with its sub-fields and split assets are read from their sub-fields
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, PutAsset_001, TestSize.Level1)
+{
+    string sessionId = "assetSession";
+    FlatObjectStore flatObjectStore("default", STORAGE_MEMORY);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId), SUCCESS);
+    Asset asset;
+    asset.id = "1";
+    asset.name = "test.txt";
+    asset.uri = "file://test.txt";
+    asset.path = "/test/test.txt";
+    asset.createTime = "2024-01-01 00:00:00";
+    asset.modifyTime = "2024-01-01 00:00:01";
+    asset.size = "1024";
+    asset.hash = "hash";
+    asset.status = Asset::STATUS_INSERT;
+    EXPECT_EQ(flatObjectStore.PutAsset(sessionId, "attachment", asset, "deviceId"), SUCCESS);
+    std::string value;
+    EXPECT_EQ(flatObjectStore.GetString(sessionId, "attachment.uri", value), SUCCESS);
+    EXPECT_EQ(value, "[STRING]file://test.txt");
+    EXPECT_EQ(flatObjectStore.GetString(sessionId, DEVICEID_KEY, value), SUCCESS);
+    EXPECT_EQ(value, "deviceId");
+    Asset result;
+    EXPECT_EQ(flatObjectStore.GetAsset(sessionId, "attachment", result), SUCCESS);
+    EXPECT_EQ(result.uri, asset.uri);
+    EXPECT_EQ(result.hash, asset.hash);
+    EXPECT_EQ(result.status, asset.status);
+    std::map<std::string, FieldValue> values;
+    EXPECT_EQ(flatObjectStore.GetAll(sessionId, values), SUCCESS);
+    EXPECT_EQ(values.count("attachment.record"), 0);
+    Bytes stored;
+    EXPECT_EQ(flatObjectStore.Get(sessionId, "r_attachment.record", stored), SUCCESS);
+
+    // A sub-field put alone, as an older peer does, is seen by the next read, which writes nothing back.
+    EXPECT_EQ(flatObjectStore.PutString(sessionId, "attachment.size", "[STRING]2048"), SUCCESS);
+    EXPECT_FALSE(flatObjectStore.assetRecords_->IsTrusted(sessionId, "attachment"));
+    EXPECT_EQ(flatObjectStore.GetAsset(sessionId, "attachment", result), SUCCESS);
+    EXPECT_EQ(result.size, "2048");
+    EXPECT_FALSE(flatObjectStore.assetRecords_->IsTrusted(sessionId, "attachment"));
+    EXPECT_EQ(flatObjectStore.PutAsset(sessionId, "attachment", result, ""), SUCCESS);
+    EXPECT_TRUE(flatObjectStore.assetRecords_->IsTrusted(sessionId, "attachment"));
+
+    std::map<std::string, FieldValue> split;
+    AssetCodec::ToFields("photo", asset, split);
+    split.erase("photo.id");
+    split.erase("photo.hash");
+    EXPECT_EQ(flatObjectStore.PutBatch(sessionId, split), SUCCESS);
+    EXPECT_EQ(flatObjectStore.GetAsset(sessionId, "photo", result), SUCCESS);
+    EXPECT_EQ(result.name, asset.name);
+    EXPECT_TRUE(result.id.empty());
+    EXPECT_EQ(flatObjectStore.GetString(sessionId, "photo.name", value), SUCCESS);
+    EXPECT_EQ(flatObjectStore.PutString(sessionId, "photo.name", ""), SUCCESS);
+    EXPECT_EQ(flatObjectStore.GetAsset(sessionId, "photo", result), SUCCESS);
+    EXPECT_TRUE(result.name.empty());
+    EXPECT_NE(flatObjectStore.GetAsset(sessionId, "missing", result), SUCCESS);
+
+    Bytes record = AssetCodec::Encode(asset);
+    record.pop_back();
+    EXPECT_NE(AssetCodec::Decode(record, result), SUCCESS);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+}
+
+/**
+ * @tc.name: GetAsset_001
+ * @tc.desc: Test a record the tracker does not know is read when its modify time and size match the sub-fields
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, GetAsset_001, TestSize.Level1)
+{
+    string sessionId = "assetRecordSession";
+    FlatObjectStore flatObjectStore("default", STORAGE_MEMORY);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId), SUCCESS);
+    Asset asset;
+    asset.name = "test.txt";
+    asset.uri = "file://test.txt";
+    asset.path = "/test/test.txt";
+    asset.createTime = "2024-01-01 00:00:00";
+    asset.modifyTime = "2024-01-01 00:00:01";
+    asset.size = "1024";
+    EXPECT_EQ(flatObjectStore.PutAsset(sessionId, "attachment", asset, ""), SUCCESS);
+
+    // As after a restart, the record was written before this process started tracking it.
+    Asset renamed = asset;
+    renamed.name = "renamed.txt";
+    std::map<std::string, std::vector<uint8_t>> data;
+    data.emplace("r_attachment.record", AssetCodec::Encode(renamed));
+    EXPECT_EQ(flatObjectStore.PutItems(sessionId, {}, data), SUCCESS);
+    flatObjectStore.assetRecords_->Clear(sessionId);
+    Asset result;
+    EXPECT_EQ(flatObjectStore.GetAsset(sessionId, "attachment", result), SUCCESS);
+    EXPECT_EQ(result.name, renamed.name);
+    EXPECT_FALSE(flatObjectStore.assetRecords_->IsTrusted(sessionId, "attachment"));
+
+    Asset modified = asset;
+    modified.modifyTime = "2024-01-01 00:00:02";
+    data.clear();
+    data.emplace("r_attachment.record", AssetCodec::Encode(modified));
+    EXPECT_EQ(flatObjectStore.PutItems(sessionId, {}, data), SUCCESS);
+    flatObjectStore.assetRecords_->Clear(sessionId);
+    EXPECT_EQ(flatObjectStore.GetAsset(sessionId, "attachment", result), SUCCESS);
+    EXPECT_EQ(result.modifyTime, asset.modifyTime);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+}
+
+/**
+ * @tc.name: PropertyHandle_001
+ * @tc.desc: Test a property handle is interned once and reads and writes the same field as its key
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, PropertyHandle_001, TestSize.Level1)
+{
+    string sessionId = "handleSession";
+    FlatObjectStore flatObjectStore("default", STORAGE_MEMORY);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId), SUCCESS);
+    PropertyHandle salary = flatObjectStore.GetPropertyHandle("salary");
+    ASSERT_NE(salary, nullptr);
+    EXPECT_EQ(salary, flatObjectStore.GetPropertyHandle("salary"));
+    EXPECT_EQ(salary->storedKey, "p_salary");
+    EXPECT_FALSE(salary->isAssetField);
+    EXPECT_TRUE(flatObjectStore.GetPropertyHandle("attachment.uri")->isAssetField);
+    EXPECT_EQ(flatObjectStore.GetPropertyHandle(""), nullptr);
+
+    EXPECT_EQ(flatObjectStore.Put(sessionId, salary, 100.5), SUCCESS);
+    double value = 0;
+    EXPECT_EQ(flatObjectStore.GetDouble(sessionId, "salary", value), SUCCESS);
+    EXPECT_EQ(value, 100.5);
+    EXPECT_EQ(flatObjectStore.PutString(sessionId, "salary", "high"), SUCCESS);
+    FieldValue result;
+    EXPECT_EQ(flatObjectStore.Get(sessionId, salary, result), SUCCESS);
+    EXPECT_EQ(std::get<std::string>(result), "high");
+    ValueView view;
+    EXPECT_EQ(flatObjectStore.GetView(sessionId, salary, view), SUCCESS);
+    EXPECT_EQ(view.type, TYPE_STRING);
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(view.data), view.size), "high");
+    EXPECT_EQ(flatObjectStore.Put(sessionId, nullptr, 1.0), ERR_INVALID_ARGS);
+    EXPECT_EQ(flatObjectStore.Get(sessionId, nullptr, result), ERR_INVALID_ARGS);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+}
+
+/**
+ * @tc.name: SchemaRecord_001
+ * @tc.desc: Put and get the fields of a schema-declared object as one compact record.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, SchemaRecord_001, TestSize.Level1)
+{
+    string sessionId = "schemaSession";
+    FlatObjectStore flatObjectStore("default", STORAGE_MEMORY);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId), SUCCESS);
+    using Note = TypedRecord<std::string, bool, double, std::vector<uint8_t>>;
+    Note note;
+    EXPECT_EQ(flatObjectStore.PutRecord(sessionId, note.GetRecord()), ERR_INVALID_ARGS);
+    ObjectSchema schema = Note::GetSchema("note");
+    ASSERT_EQ(flatObjectStore.BindSchema(sessionId, schema), SUCCESS);
+    note.Set<0>("title");
+    note.Set<2>(3.5);
+    note.Set<3>({ 1, 2 });
+    ASSERT_EQ(flatObjectStore.PutRecord(sessionId, note.GetRecord()), SUCCESS);
+
+    Note result;
+    ASSERT_EQ(flatObjectStore.GetRecord(sessionId, result.GetRecord()), SUCCESS);
+    ASSERT_NE(result.Get<0>(), nullptr);
+    EXPECT_EQ(*result.Get<0>(), "title");
+    EXPECT_EQ(result.Get<1>(), nullptr);
+    EXPECT_EQ(*result.Get<2>(), 3.5);
+    EXPECT_EQ(*result.Get<3>(), std::vector<uint8_t>({ 1, 2 }));
+    Bytes data;
+    ASSERT_EQ(SchemaCodec::Encode(schema, note.GetRecord(), data), SUCCESS);
+    // Header of 4 bytes, one type byte and the payloads: 6 for the string, 8 for the double, 3 for the bytes.
+    EXPECT_EQ(data.size(), 22u);
+
+    // The record is outside the property namespace, a property of any name leaves it alone.
+    EXPECT_EQ(flatObjectStore.PutString(sessionId, "__record", "[STRING]user"), SUCCESS);
+    EXPECT_EQ(flatObjectStore.PutString(sessionId, ".schema", "[STRING]user"), SUCCESS);
+    std::map<std::string, FieldValue> values;
+    EXPECT_EQ(flatObjectStore.GetAll(sessionId, values), SUCCESS);
+    EXPECT_EQ(values.size(), 2u);
+    ASSERT_EQ(flatObjectStore.GetRecord(sessionId, result.GetRecord()), SUCCESS);
+    EXPECT_EQ(*result.Get<0>(), "title");
+    SchemaRecord wrongType(1);
+    wrongType.Set(0, 1.0);
+    EXPECT_EQ(flatObjectStore.PutRecord(sessionId, wrongType), ERR_INVALID_ARGS);
+
+    schema.types.push_back(TYPE_BOOLEAN);
+    EXPECT_EQ(flatObjectStore.BindSchema(sessionId, schema), SUCCESS);
+    SchemaRecord upgraded;
+    ASSERT_EQ(flatObjectStore.GetRecord(sessionId, upgraded), SUCCESS);
+    EXPECT_EQ(upgraded.GetFieldCount(), 5u);
+    EXPECT_FALSE(upgraded.Has(4));
+    schema.types[0] = TYPE_DOUBLE;
+    EXPECT_EQ(flatObjectStore.BindSchema(sessionId, schema), ERR_INVALID_ARGS);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+}
+
+/**
+ * @tc.name: SchemaRecord_002
+ * @tc.desc: Test a put of some fields keeps the stored values of the fields it does not set
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, SchemaRecord_002, TestSize.Level1)
+{
+    string sessionId = "mergeSession";
+    FlatObjectStore flatObjectStore("default", STORAGE_MEMORY);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId), SUCCESS);
+    using Note = TypedRecord<std::string, bool, double>;
+    ASSERT_EQ(flatObjectStore.BindSchema(sessionId, Note::GetSchema("note")), SUCCESS);
+    Note title;
+    title.Set<0>("title");
+    ASSERT_EQ(flatObjectStore.PutRecord(sessionId, title.GetRecord()), SUCCESS);
+    Note mark;
+    mark.Set<2>(3.5);
+    ASSERT_EQ(flatObjectStore.PutRecord(sessionId, mark.GetRecord()), SUCCESS);
+
+    Note result;
+    ASSERT_EQ(flatObjectStore.GetRecord(sessionId, result.GetRecord()), SUCCESS);
+    ASSERT_NE(result.Get<0>(), nullptr);
+    EXPECT_EQ(*result.Get<0>(), "title");
+    EXPECT_EQ(result.Get<1>(), nullptr);
+    ASSERT_NE(result.Get<2>(), nullptr);
+    EXPECT_EQ(*result.Get<2>(), 3.5);
+
+    title.Set<0>("renamed");
+    ASSERT_EQ(flatObjectStore.PutRecord(sessionId, title.GetRecord()), SUCCESS);
+    ASSERT_EQ(flatObjectStore.GetRecord(sessionId, result.GetRecord()), SUCCESS);
+    EXPECT_EQ(*result.Get<0>(), "renamed");
+    EXPECT_EQ(*result.Get<2>(), 3.5);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
+}
+
+/**
+ * @tc.name: GetVersion_001
+ * @tc.desc: Test each put publishes a new version of the session items
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlatObjectStoreTest, GetVersion_001, TestSize.Level1)
+{
+    string sessionId = "versionSession";
+    FlatObjectStore flatObjectStore("default", STORAGE_MEMORY);
+    ASSERT_EQ(flatObjectStore.CreateObject(sessionId), SUCCESS);
+    uint64_t before = 0;
+    ASSERT_EQ(flatObjectStore.GetVersion(sessionId, before), SUCCESS);
+    EXPECT_EQ(flatObjectStore.PutDouble(sessionId, "salary", 1.5), SUCCESS);
+    uint64_t after = 0;
+    ASSERT_EQ(flatObjectStore.GetVersion(sessionId, after), SUCCESS);
+    EXPECT_EQ(after, before + 1);
+    EXPECT_EQ(flatObjectStore.Delete(sessionId), SUCCESS);
 }
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "key_index.h"
+
+using namespace testing::ext;
+using namespace OHOS::ObjectStore;
+using namespace OHOS;
+using namespace std;
+
+namespace {
+class KeyIndexTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void KeyIndexTest::SetUpTestCase(void)
+{
+    // input testsuit setup step，setup invoked before all testcases
+}
+
+void KeyIndexTest::TearDownTestCase(void)
+{
+    // input testsuit teardown step，teardown invoked after all testcases
+}
+
+void KeyIndexTest::SetUp(void)
+{
+    // input testcase setup step，setup invoked before each testcases
+}
+
+void KeyIndexTest::TearDown(void)
+{
+    // input testcase teardown step，teardown invoked after each testcases
+}
+
+/**
+ * @tc.name: EraseExisting_001
+ * @tc.desc: Abnormal test for EraseExisting, the session is not tracked
+ * @tc.type: FUNC
+ */
+HWTEST_F(KeyIndexTest, EraseExisting_001, TestSize.Level1)
+{
+    KeyIndex index;
+    std::map<std::string, std::vector<uint8_t>> data = { { "p_name", { 1 } } };
+    EXPECT_FALSE(index.EraseExisting("session", data));
+    EXPECT_EQ(data.size(), 1);
+}
+
+/**
+ * @tc.name: EraseExisting_002
+ * @tc.desc: Abnormal test for EraseExisting, the session has begun but is not loaded
+ * @tc.type: FUNC
+ */
+HWTEST_F(KeyIndexTest, EraseExisting_002, TestSize.Level1)
+{
+    KeyIndex index;
+    index.Begin("session");
+    index.Insert("session", "p_name");
+    std::map<std::string, std::vector<uint8_t>> data = { { "p_name", { 1 } } };
+    EXPECT_FALSE(index.EraseExisting("session", data));
+    EXPECT_EQ(data.size(), 1);
+}
+
+/**
+ * @tc.name: Load_001
+ * @tc.desc: Test loaded keys are erased from the data and other keys are kept
+ * @tc.type: FUNC
+ */
+HWTEST_F(KeyIndexTest, Load_001, TestSize.Level1)
+{
+    KeyIndex index;
+    index.Begin("session");
+    index.Load("session", { "p_name" });
+    std::map<std::string, std::vector<uint8_t>> data = { { "p_name", { 1 } }, { "p_age", { 2 } } };
+    EXPECT_TRUE(index.EraseExisting("session", data));
+    ASSERT_EQ(data.size(), 1);
+    EXPECT_EQ(data.count("p_age"), 1);
+}
+
+/**
+ * @tc.name: Load_002
+ * @tc.desc: Test a delete seen before Load wins over the scan
+ * @tc.type: FUNC
+ */
+HWTEST_F(KeyIndexTest, Load_002, TestSize.Level1)
+{
+    KeyIndex index;
+    index.Begin("session");
+    index.Apply("session", {}, { "p_name" });
+    index.Load("session", { "p_name", "p_age" });
+    std::map<std::string, std::vector<uint8_t>> data = { { "p_name", { 1 } }, { "p_age", { 2 } } };
+    EXPECT_TRUE(index.EraseExisting("session", data));
+    ASSERT_EQ(data.size(), 1);
+    EXPECT_EQ(data.count("p_name"), 1);
+}
+
+/**
+ * @tc.name: Load_003
+ * @tc.desc: Abnormal test for Load, the session has not begun
+ * @tc.type: FUNC
+ */
+HWTEST_F(KeyIndexTest, Load_003, TestSize.Level1)
+{
+    KeyIndex index;
+    index.Load("session", { "p_name" });
+    std::map<std::string, std::vector<uint8_t>> data = { { "p_name", { 1 } } };
+    EXPECT_FALSE(index.EraseExisting("session", data));
+}
+
+/**
+ * @tc.name: Insert_001
+ * @tc.desc: Test an inserted key is erased from the data
+ * @tc.type: FUNC
+ */
+HWTEST_F(KeyIndexTest, Insert_001, TestSize.Level1)
+{
+    KeyIndex index;
+    index.Begin("session");
+    index.Load("session", {});
+    index.Insert("session", "p_name");
+    std::map<std::string, std::vector<uint8_t>> data = { { "p_name", { 1 } } };
+    EXPECT_TRUE(index.EraseExisting("session", data));
+    EXPECT_TRUE(data.empty());
+}
+
+/**
+ * @tc.name: Insert_002
+ * @tc.desc: Test the keys of inserted data are erased from the data
+ * @tc.type: FUNC
+ */
+HWTEST_F(KeyIndexTest, Insert_002, TestSize.Level1)
+{
+    KeyIndex index;
+    index.Begin("session");
+    index.Load("session", {});
+    index.Insert("session", { { "p_name", { 1 } }, { "p_age", { 2 } } });
+    std::map<std::string, std::vector<uint8_t>> data = { { "p_name", { 3 } }, { "p_age", { 4 } } };
+    EXPECT_TRUE(index.EraseExisting("session", data));
+    EXPECT_TRUE(data.empty());
+}
+
+/**
+ * @tc.name: Apply_001
+ * @tc.desc: Test remote upserts add keys and remote deletes remove them after Load
+ * @tc.type: FUNC
+ */
+HWTEST_F(KeyIndexTest, Apply_001, TestSize.Level1)
+{
+    KeyIndex index;
+    index.Begin("session");
+    index.Load("session", { "p_name" });
+    index.Apply("session", { "p_age" }, { "p_name" });
+    std::map<std::string, std::vector<uint8_t>> data = { { "p_name", { 1 } }, { "p_age", { 2 } } };
+    EXPECT_TRUE(index.EraseExisting("session", data));
+    ASSERT_EQ(data.size(), 1);
+    EXPECT_EQ(data.count("p_name"), 1);
+}
+
+/**
+ * @tc.name: Drop_001
+ * @tc.desc: Test a dropped session no longer answers queries
+ * @tc.type: FUNC
+ */
+HWTEST_F(KeyIndexTest, Drop_001, TestSize.Level1)
+{
+    KeyIndex index;
+    index.Begin("session");
+    index.Load("session", { "p_name" });
+    index.Drop("session");
+    std::map<std::string, std::vector<uint8_t>> data = { { "p_name", { 1 } } };
+    EXPECT_FALSE(index.EraseExisting("session", data));
+    EXPECT_EQ(data.size(), 1);
+}
+}
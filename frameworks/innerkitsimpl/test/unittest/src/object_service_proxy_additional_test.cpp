@@ -15,6 +15,8 @@
 
 #include <gtest/gtest.h>
 
+#include "ipc_object_stub.h"
+#include "ipc_types.h"
 #include "object_service_proxy.h"
 #include "objectstore_errors.h"
 
@@ -25,6 +27,20 @@ using namespace OHOS;
 using namespace std;
 
 namespace {
+class RejectingStub : public IPCObjectStub {
+public:
+    explicit RejectingStub(int32_t error) : error_(error) {}
+    int OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override
+    {
+        calls_++;
+        return error_;
+    }
+    int32_t calls_ = 0;
+
+private:
+    int32_t error_;
+};
+
 class ObjectServiceProxyAdditionalTest : public testing::Test {
 public:
     static void SetUpTestCase(void);
@@ -69,6 +85,64 @@ HWTEST_F(ObjectServiceProxyAdditionalTest, ObjectStoreSave_001, TestSize.Level1)
     EXPECT_EQ(ret, OHOS::ObjectStore::ERR_IPC);
 }
 
+/**
+ * @tc.name: ObjectStoreSaveDelta_001
+ * @tc.desc: Abnormal test for ObjectStoreSaveDelta
+ * @tc.type: FUNC
+ */
+HWTEST_F(ObjectServiceProxyAdditionalTest, ObjectStoreSaveDelta_001, TestSize.Level1)
+{
+    string bundleName = "testBundle";
+    string sessionId = "testSession";
+    string deviceId = "testDevice";
+    map<string, vector<uint8_t>> objectData = {
+        { "key1", { 1, 2, 3 } }
+    };
+    sptr<IRemoteObject> impl = nullptr;
+    sptr<IRemoteObject> callback = nullptr;
+    ObjectServiceProxy proxy(impl);
+    auto ret = proxy.ObjectStoreSaveDelta(bundleName, sessionId, deviceId, objectData, callback);
+    EXPECT_EQ(ret, OHOS::ObjectStore::ERR_IPC);
+}
+
+/**
+ * @tc.name: ObjectStoreSaveDelta_002
+ * @tc.desc: A service that does not know the delta save code is not asked again
+ * @tc.type: FUNC
+ */
+HWTEST_F(ObjectServiceProxyAdditionalTest, ObjectStoreSaveDelta_002, TestSize.Level1)
+{
+    map<string, vector<uint8_t>> objectData = {
+        { "key1", { 1, 2, 3 } }
+    };
+    sptr<RejectingStub> stub = new RejectingStub(IPC_STUB_UNKNOW_TRANS_ERR);
+    ObjectServiceProxy proxy(stub);
+    auto ret = proxy.ObjectStoreSaveDelta("testBundle", "testSession", "testDevice", objectData, nullptr);
+    EXPECT_EQ(ret, OHOS::ObjectStore::ERR_IPC);
+    ret = proxy.ObjectStoreSaveDelta("testBundle", "testSession", "testDevice", objectData, nullptr);
+    EXPECT_EQ(ret, OHOS::ObjectStore::ERR_IPC);
+    EXPECT_EQ(stub->calls_, 1);
+}
+
+/**
+ * @tc.name: ObjectStoreSaveDelta_003
+ * @tc.desc: A transient SendRequest failure leaves delta saves on
+ * @tc.type: FUNC
+ */
+HWTEST_F(ObjectServiceProxyAdditionalTest, ObjectStoreSaveDelta_003, TestSize.Level1)
+{
+    map<string, vector<uint8_t>> objectData = {
+        { "key1", { 1, 2, 3 } }
+    };
+    sptr<RejectingStub> stub = new RejectingStub(IPC_STUB_WRITE_PARCEL_ERR);
+    ObjectServiceProxy proxy(stub);
+    auto ret = proxy.ObjectStoreSaveDelta("testBundle", "testSession", "testDevice", objectData, nullptr);
+    EXPECT_EQ(ret, OHOS::ObjectStore::ERR_IPC);
+    ret = proxy.ObjectStoreSaveDelta("testBundle", "testSession", "testDevice", objectData, nullptr);
+    EXPECT_EQ(ret, OHOS::ObjectStore::ERR_IPC);
+    EXPECT_EQ(stub->calls_, 2);
+}
+
 /**
  * @tc.name: ObjectStoreRevokeSave_001
  * @tc.desc: Abnormal test for ObjectStoreRevokeSave
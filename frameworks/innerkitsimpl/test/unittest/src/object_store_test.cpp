@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <future>
 #include <thread>
 
 #include "accesstoken_kit.h"
@@ -219,6 +220,40 @@ HWTEST_F(NativeObjectStoreTest, DistributedObjectStore_Create_Destroy_004, TestS
     EXPECT_EQ(SUCCESS, ret);
 }
 
+/**
+ * @tc.name: DistributedObjectStore_CreateObjectAsync_001
+ * @tc.desc: test creating a DistributedObject asynchronously, with and without a prepared table
+ * @tc.type: FUNC
+ */
+HWTEST_F(NativeObjectStoreTest, DistributedObjectStore_CreateObjectAsync_001, TestSize.Level0)
+{
+    std::string bundleName = "default";
+    std::string sessionId = "123456";
+    DistributedObjectStore *objectStore = DistributedObjectStore::GetInstance(bundleName);
+    ASSERT_NE(nullptr, objectStore);
+
+    for (bool prepare : { false, true }) {
+        if (prepare) {
+            EXPECT_EQ(SUCCESS, objectStore->PrepareObject(sessionId));
+        }
+        std::promise<std::pair<DistributedObject *, uint32_t>> promise;
+        objectStore->CreateObjectAsync(sessionId, [&promise](DistributedObject *object, uint32_t status) {
+            promise.set_value({ object, status });
+        });
+        auto [object, status] = promise.get_future().get();
+        ASSERT_NE(nullptr, object);
+        EXPECT_EQ(SUCCESS, status);
+        EXPECT_EQ(ERR_EXIST, objectStore->PrepareObject(sessionId));
+        EXPECT_EQ(SUCCESS, objectStore->DeleteObject(sessionId));
+    }
+
+    std::promise<uint32_t> failed;
+    objectStore->CreateObjectAsync("", [&failed](DistributedObject *object, uint32_t status) {
+        failed.set_value(status);
+    });
+    EXPECT_EQ(ERR_INVALID_ARGS, failed.get_future().get());
+}
+
 /**
  * @tc.name: DistributedObjectStoreImpl_CreateObject_001
  * @tc.desc: test Create DistributedObjectStoreImpl
@@ -1377,6 +1412,30 @@ HWTEST_F(NativeObjectStoreTest, DistributedObject_CreateTable_004, TestSize.Leve
     EXPECT_EQ(ERR_DB_GETKV_FAIL, ret);
 }
 
+/**
+ * @tc.name: DistributedObject_CreateTable_005
+ * @tc.desc: test ObjectStorageEngine CreateTable, concurrent creates of one table, only one of them succeeds.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NativeObjectStoreTest, DistributedObject_CreateTable_005, TestSize.Level0)
+{
+    std::string bundleName = "default";
+    std::string sessionId = "123456";
+    auto objectStorageEngine = std::make_shared<FlatObjectStorageEngine>();
+    uint32_t ret = objectStorageEngine->Open(bundleName);
+    EXPECT_EQ(SUCCESS, ret);
+    auto create = [objectStorageEngine, sessionId]() { return objectStorageEngine->CreateTable(sessionId); };
+    auto first = std::async(std::launch::async, create);
+    auto second = std::async(std::launch::async, create);
+    uint32_t firstRet = first.get();
+    uint32_t secondRet = second.get();
+    EXPECT_TRUE((firstRet == SUCCESS) != (secondRet == SUCCESS));
+    EXPECT_TRUE(firstRet == ERR_EXIST || secondRet == ERR_EXIST);
+    ret = objectStorageEngine->DeleteTable(sessionId);
+    EXPECT_EQ(SUCCESS, ret);
+    objectStorageEngine->Close();
+}
+
 /**
  * @tc.name: DistributedObject_GetTable_005
  * @tc.desc: test FlatObjectStorageEngine GetTable, storageEngine is not open or sessionId is empty.
@@ -1445,6 +1504,32 @@ HWTEST_F(NativeObjectStoreTest, DistributedObject_UpdateItems_003, TestSize.Leve
     storageEngine->DeleteTable(sessionId);
 }
 
+/**
+ * @tc.name: DistributedObject_UpdateItems_005
+ * @tc.desc: test FlatObjectStorageEngine UpdateItems, keys of a failed write are not filtered as existing.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NativeObjectStoreTest, DistributedObject_UpdateItems_005, TestSize.Level0)
+{
+    std::string bundleName = "default";
+    std::string sessionId = "123456";
+    std::shared_ptr<FlatObjectStorageEngine> storageEngine = std::make_shared<FlatObjectStorageEngine>();
+    storageEngine->Open(bundleName);
+    storageEngine->CreateTable(sessionId);
+    std::vector<uint8_t> value = { 1, 8 };
+    std::string longKey(1025, 't');
+    std::map<std::string, std::vector<uint8_t>> data = { { "age", value }, { longKey, value } };
+    uint32_t ret = storageEngine->UpdateItems(sessionId, data);
+    EXPECT_EQ(ERR_CLOSE_STORAGE, ret);
+
+    ret = storageEngine->FilterExistingItems(sessionId, data);
+    EXPECT_EQ(SUCCESS, ret);
+    EXPECT_EQ(data.size(), 2);
+    EXPECT_EQ(data.count("age"), 1);
+    EXPECT_EQ(data.count(longKey), 1);
+    storageEngine->DeleteTable(sessionId);
+}
+
 /**
  * @tc.name: DistributedObject_DeleteTable_001
  * @tc.desc: test FlatObjectStorageEngine DeleteTable, storageEngine is not open or error sessionid.
@@ -1503,6 +1588,98 @@ HWTEST_F(NativeObjectStoreTest, DistributedObject_GetItem_003, TestSize.Level0)
     EXPECT_EQ(ERR_DB_NOT_EXIST, ret);
 }
 
+/**
+ * @tc.name: DistributedObject_WriteBuffer_001
+ * @tc.desc: test FlatObjectStorageEngine UpdateItem, buffered value is visible before flush.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NativeObjectStoreTest, DistributedObject_WriteBuffer_001, TestSize.Level0)
+{
+    std::string bundleName = "default";
+    std::string sessionId = "123456";
+    std::shared_ptr<FlatObjectStorageEngine> storageEngine = std::make_shared<FlatObjectStorageEngine>();
+    storageEngine->Open(bundleName);
+    storageEngine->CreateTable(sessionId);
+    std::vector<uint8_t> value = { 1, 8 };
+    uint32_t ret = storageEngine->UpdateItem(sessionId, "age", value);
+    EXPECT_EQ(SUCCESS, ret);
+    std::vector<uint8_t> result;
+    ret = storageEngine->GetItem(sessionId, "age", result);
+    EXPECT_EQ(SUCCESS, ret);
+    EXPECT_EQ(value, result);
+    ret = storageEngine->Flush(sessionId);
+    EXPECT_EQ(SUCCESS, ret);
+    ret = storageEngine->Flush("123");
+    EXPECT_EQ(ERR_DB_NOT_EXIST, ret);
+    ret = storageEngine->DeleteTable(sessionId);
+    EXPECT_EQ(SUCCESS, ret);
+}
+
+/**
+ * @tc.name: DistributedObject_SyncPolicy_001
+ * @tc.desc: test FlatObjectStorageEngine SetSyncPolicy and Commit.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NativeObjectStoreTest, DistributedObject_SyncPolicy_001, TestSize.Level0)
+{
+    std::string bundleName = "default";
+    std::string sessionId = "sync_policy_1";
+    std::shared_ptr<FlatObjectStorageEngine> storageEngine = std::make_shared<FlatObjectStorageEngine>();
+    storageEngine->Open(bundleName);
+    EXPECT_EQ(SUCCESS, storageEngine->CreateTable(sessionId));
+    EXPECT_EQ(ERR_INVALID_ARGS, storageEngine->SetSyncPolicy(sessionId, SYNC_WINDOWED, 0));
+    EXPECT_EQ(ERR_DB_NOT_EXIST, storageEngine->SetSyncPolicy("123", SYNC_MANUAL, 0));
+    EXPECT_EQ(SUCCESS, storageEngine->SetSyncPolicy(sessionId, SYNC_WINDOWED, 100));
+    std::vector<uint8_t> value = { 1, 8 };
+    EXPECT_EQ(SUCCESS, storageEngine->UpdateItem(sessionId, "age", value));
+    EXPECT_EQ(SUCCESS, storageEngine->Flush(sessionId));
+    EXPECT_NE(Executor::INVALID_TASK_ID, storageEngine->GetSession(sessionId)->syncTask);
+    EXPECT_EQ(SUCCESS, storageEngine->SetSyncPolicy(sessionId, SYNC_MANUAL, 0));
+    EXPECT_EQ(Executor::INVALID_TASK_ID, storageEngine->GetSession(sessionId)->syncTask);
+    EXPECT_EQ(SUCCESS, storageEngine->UpdateItem(sessionId, "age", value));
+    EXPECT_EQ(SUCCESS, storageEngine->Commit(sessionId));
+    std::vector<uint8_t> result;
+    EXPECT_EQ(SUCCESS, storageEngine->GetItem(sessionId, "age", result));
+    EXPECT_EQ(value, result);
+    EXPECT_EQ(ERR_DB_NOT_EXIST, storageEngine->Commit("123"));
+    EXPECT_EQ(SUCCESS, storageEngine->SetSyncPolicy(sessionId, SYNC_AUTO, 0));
+    EXPECT_EQ(SUCCESS, storageEngine->DeleteTable(sessionId));
+}
+
+/**
+ * @tc.name: DistributedObject_SessionLock_001
+ * @tc.desc: test FlatObjectStorageEngine, independent sessions are updated concurrently.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NativeObjectStoreTest, DistributedObject_SessionLock_001, TestSize.Level0)
+{
+    std::string bundleName = "default";
+    std::vector<std::string> sessionIds = { "session_lock_1", "session_lock_2", "session_lock_3" };
+    std::shared_ptr<FlatObjectStorageEngine> storageEngine = std::make_shared<FlatObjectStorageEngine>();
+    storageEngine->Open(bundleName);
+    for (auto &sessionId : sessionIds) {
+        EXPECT_EQ(SUCCESS, storageEngine->CreateTable(sessionId));
+    }
+    std::vector<std::thread> threads;
+    for (auto &sessionId : sessionIds) {
+        threads.emplace_back([storageEngine, sessionId]() {
+            std::vector<uint8_t> value = { 1, 8 };
+            for (int i = 0; i < 10; i++) {
+                storageEngine->UpdateItem(sessionId, "p_key" + std::to_string(i), value);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (auto &sessionId : sessionIds) {
+        std::map<std::string, std::vector<uint8_t>> data;
+        EXPECT_EQ(SUCCESS, storageEngine->GetItems(sessionId, data));
+        EXPECT_EQ(10, data.size());
+        EXPECT_EQ(SUCCESS, storageEngine->DeleteTable(sessionId));
+    }
+}
+
 /**
  * @tc.name: DistributedObject_RegisterObserver_001
  * @tc.desc: test FlatObjectStorageEngine RegisterObserver, storageEngine is not open.
@@ -1644,6 +1821,42 @@ HWTEST_F(NativeObjectStoreTest, DistributedObject_GetItems_001, TestSize.Level0)
     EXPECT_EQ(SUCCESS, ret);
 }
 
+/**
+ * @tc.name: DistributedObject_ForEachItem_001
+ * @tc.desc: test FlatObjectStorageEngine ForEachItem, buffered items are visited and the visitor can stop early.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NativeObjectStoreTest, DistributedObject_ForEachItem_001, TestSize.Level0)
+{
+    std::string bundleName = "default";
+    std::string sessionId = "123456";
+    std::shared_ptr<FlatObjectStorageEngine> storageEngine = std::make_shared<FlatObjectStorageEngine>();
+    storageEngine->Open(bundleName);
+    storageEngine->CreateTable(sessionId);
+    std::map<std::string, std::vector<uint8_t>> data = { { "age", { 1, 8 } }, { "name", { 0, 6 } } };
+    EXPECT_EQ(SUCCESS, storageEngine->UpdateItems(sessionId, data));
+    std::map<std::string, std::vector<uint8_t>> visited;
+    uint32_t ret = storageEngine->ForEachItem(sessionId, [&visited](std::string_view itemKey, const Value &value) {
+        visited.insert_or_assign(std::string(itemKey), value);
+        return true;
+    });
+    EXPECT_EQ(SUCCESS, ret);
+    EXPECT_EQ(data, visited);
+    uint32_t count = 0;
+    ret = storageEngine->ForEachItem(sessionId, [&count](std::string_view, const Value &) {
+        count++;
+        return false;
+    });
+    EXPECT_EQ(SUCCESS, ret);
+    EXPECT_EQ(1, count);
+    ret = storageEngine->ForEachItem("", [](std::string_view, const Value &) { return true; });
+    EXPECT_EQ(ERR_DB_NOT_EXIST, ret);
+    ret = storageEngine->ForEachItem(sessionId, nullptr);
+    EXPECT_EQ(ERR_INVALID_ARGS, ret);
+    ret = storageEngine->DeleteTable(sessionId);
+    EXPECT_EQ(SUCCESS, ret);
+}
+
 /**
  * @tc.name: DistributedObject_NotifyStatus_001
  * @tc.desc: test FlatObjectStorageEngine NotifyStatus.
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "save_queue.h"
+
+#include "block_data.h"
+#include "objectstore_errors.h"
+
+using namespace testing::ext;
+using namespace OHOS::ObjectStore;
+using namespace OHOS;
+using namespace std;
+
+namespace {
+class SaveQueueTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void SaveQueueTest::SetUpTestCase(void)
+{
+    // input testsuit setup step，setup invoked before all testcases
+}
+
+void SaveQueueTest::TearDownTestCase(void)
+{
+    // input testsuit teardown step，teardown invoked after all testcases
+}
+
+void SaveQueueTest::SetUp(void)
+{
+    // input testcase setup step，setup invoked before each testcases
+}
+
+void SaveQueueTest::TearDown(void)
+{
+    // input testcase teardown step，teardown invoked after each testcases
+}
+
+constexpr uint32_t WAIT_TIME = 1000;
+using Result = BlockData<uint32_t, std::chrono::milliseconds>;
+using Started = BlockData<bool, std::chrono::milliseconds>;
+
+SaveQueue::Task Answer(uint32_t status)
+{
+    return [status](const SaveQueue::Done &done) {
+        done(status);
+        return SUCCESS;
+    };
+}
+
+// Keeps the done callback of the task so the test answers it later.
+SaveQueue::Task Hold(std::shared_ptr<SaveQueue::Done> held, std::shared_ptr<Started> started)
+{
+    return [held, started](const SaveQueue::Done &done) {
+        *held = done;
+        started->SetValue(true);
+        return SUCCESS;
+    };
+}
+
+SaveQueue::Done Record(std::shared_ptr<Result> result)
+{
+    return [result](uint32_t status) { result->SetValue(status); };
+}
+
+/**
+ * @tc.name: Submit_001
+ * @tc.desc: Test an operation completes with the status its task answers
+ * @tc.type: FUNC
+ */
+HWTEST_F(SaveQueueTest, Submit_001, TestSize.Level1)
+{
+    auto queue = std::make_shared<SaveQueue>();
+    auto result = std::make_shared<Result>(WAIT_TIME, ERR_DB_GET_FAIL);
+    queue->Submit("session", WAIT_TIME, Answer(ERR_IPC), Record(result));
+    EXPECT_EQ(result->GetValue(), ERR_IPC);
+    EXPECT_EQ(queue->GetPendingCount("session"), 0);
+}
+
+/**
+ * @tc.name: Submit_002
+ * @tc.desc: Test an operation whose task fails to start completes with that status and the next one starts
+ * @tc.type: FUNC
+ */
+HWTEST_F(SaveQueueTest, Submit_002, TestSize.Level1)
+{
+    auto queue = std::make_shared<SaveQueue>();
+    auto firstResult = std::make_shared<Result>(WAIT_TIME, ERR_DB_GET_FAIL);
+    queue->Submit("session", WAIT_TIME, [](const SaveQueue::Done &) { return ERR_PROCESSING; },
+        Record(firstResult));
+    auto secondResult = std::make_shared<Result>(WAIT_TIME, ERR_DB_GET_FAIL);
+    queue->Submit("session", WAIT_TIME, Answer(SUCCESS), Record(secondResult));
+    EXPECT_EQ(firstResult->GetValue(), ERR_PROCESSING);
+    EXPECT_EQ(secondResult->GetValue(), SUCCESS);
+}
+
+/**
+ * @tc.name: Submit_003
+ * @tc.desc: Test operations of a session run one at a time in submit order
+ * @tc.type: FUNC
+ */
+HWTEST_F(SaveQueueTest, Submit_003, TestSize.Level1)
+{
+    auto queue = std::make_shared<SaveQueue>();
+    auto held = std::make_shared<SaveQueue::Done>();
+    auto started = std::make_shared<Started>(WAIT_TIME, false);
+    auto firstResult = std::make_shared<Result>(WAIT_TIME, ERR_DB_GET_FAIL);
+    queue->Submit("session", WAIT_TIME, Hold(held, started), Record(firstResult));
+    auto secondStarted = std::make_shared<Started>(WAIT_TIME, false);
+    auto secondHeld = std::make_shared<SaveQueue::Done>();
+    auto secondResult = std::make_shared<Result>(WAIT_TIME, ERR_DB_GET_FAIL);
+    queue->Submit("session", WAIT_TIME, Hold(secondHeld, secondStarted), Record(secondResult));
+    ASSERT_TRUE(started->GetValue());
+    EXPECT_EQ(queue->GetPendingCount("session"), 2);
+    EXPECT_EQ(*secondHeld, nullptr);
+
+    (*held)(SUCCESS);
+    EXPECT_EQ(firstResult->GetValue(), SUCCESS);
+    ASSERT_TRUE(secondStarted->GetValue());
+    (*secondHeld)(SUCCESS);
+    EXPECT_EQ(secondResult->GetValue(), SUCCESS);
+    EXPECT_EQ(queue->GetPendingCount("session"), 0);
+}
+
+/**
+ * @tc.name: Submit_004
+ * @tc.desc: Test an operation of another session does not wait for a running one
+ * @tc.type: FUNC
+ */
+HWTEST_F(SaveQueueTest, Submit_004, TestSize.Level1)
+{
+    auto queue = std::make_shared<SaveQueue>();
+    auto held = std::make_shared<SaveQueue::Done>();
+    auto started = std::make_shared<Started>(WAIT_TIME, false);
+    queue->Submit("session1", WAIT_TIME, Hold(held, started), nullptr);
+    auto otherResult = std::make_shared<Result>(WAIT_TIME, ERR_DB_GET_FAIL);
+    queue->Submit("session2", WAIT_TIME, Answer(SUCCESS), Record(otherResult));
+    EXPECT_EQ(otherResult->GetValue(), SUCCESS);
+    ASSERT_TRUE(started->GetValue());
+    EXPECT_EQ(queue->GetPendingCount("session1"), 1);
+    (*held)(SUCCESS);
+    EXPECT_EQ(queue->GetPendingCount("session1"), 0);
+}
+
+/**
+ * @tc.name: Submit_005
+ * @tc.desc: Test a running operation past its deadline completes with ERR_TIMEOUT and holds the session until
+ *           its task answers
+ * @tc.type: FUNC
+ */
+HWTEST_F(SaveQueueTest, Submit_005, TestSize.Level1)
+{
+    auto queue = std::make_shared<SaveQueue>();
+    auto held = std::make_shared<SaveQueue::Done>();
+    auto started = std::make_shared<Started>(WAIT_TIME, false);
+    auto timeoutResult = std::make_shared<Result>(WAIT_TIME, ERR_DB_GET_FAIL);
+    uint64_t timedOut = queue->Submit("session", 10, Hold(held, started), Record(timeoutResult));
+    EXPECT_EQ(timeoutResult->GetValue(), ERR_TIMEOUT);
+    EXPECT_FALSE(queue->Cancel(timedOut));
+    auto afterResult = std::make_shared<Result>(WAIT_TIME, ERR_DB_GET_FAIL);
+    queue->Submit("session", WAIT_TIME, Answer(SUCCESS), Record(afterResult));
+    EXPECT_EQ(queue->GetPendingCount("session"), 2);
+    ASSERT_TRUE(started->GetValue());
+    (*held)(SUCCESS);
+    EXPECT_EQ(afterResult->GetValue(), SUCCESS);
+    EXPECT_EQ(queue->GetPendingCount("session"), 0);
+}
+
+/**
+ * @tc.name: Cancel_001
+ * @tc.desc: Test a waiting operation is canceled once and gives up its place
+ * @tc.type: FUNC
+ */
+HWTEST_F(SaveQueueTest, Cancel_001, TestSize.Level1)
+{
+    auto queue = std::make_shared<SaveQueue>();
+    auto held = std::make_shared<SaveQueue::Done>();
+    auto started = std::make_shared<Started>(WAIT_TIME, false);
+    queue->Submit("session", WAIT_TIME, Hold(held, started), nullptr);
+    auto result = std::make_shared<Result>(WAIT_TIME, ERR_DB_GET_FAIL);
+    uint64_t waiting = queue->Submit("session", WAIT_TIME, Answer(SUCCESS), Record(result));
+    EXPECT_TRUE(queue->Cancel(waiting));
+    EXPECT_EQ(result->GetValue(), ERR_CANCELED);
+    EXPECT_FALSE(queue->Cancel(waiting));
+    EXPECT_EQ(queue->GetPendingCount("session"), 1);
+    ASSERT_TRUE(started->GetValue());
+    (*held)(SUCCESS);
+    EXPECT_EQ(queue->GetPendingCount("session"), 0);
+}
+
+/**
+ * @tc.name: Cancel_002
+ * @tc.desc: Test a canceled running operation is completed once and the late answer of its task is dropped
+ * @tc.type: FUNC
+ */
+HWTEST_F(SaveQueueTest, Cancel_002, TestSize.Level1)
+{
+    auto queue = std::make_shared<SaveQueue>();
+    auto held = std::make_shared<SaveQueue::Done>();
+    auto started = std::make_shared<Started>(WAIT_TIME, false);
+    std::vector<uint32_t> results;
+    uint64_t running = queue->Submit("session", WAIT_TIME, Hold(held, started),
+        [&results](uint32_t status) { results.push_back(status); });
+    ASSERT_TRUE(started->GetValue());
+    EXPECT_TRUE(queue->Cancel(running));
+    EXPECT_EQ(queue->GetPendingCount("session"), 1);
+    (*held)(SUCCESS);
+    EXPECT_EQ(queue->GetPendingCount("session"), 0);
+    EXPECT_EQ(results, std::vector<uint32_t>({ ERR_CANCELED }));
+}
+
+/**
+ * @tc.name: CancelAll_001
+ * @tc.desc: Test every operation of a session is canceled
+ * @tc.type: FUNC
+ */
+HWTEST_F(SaveQueueTest, CancelAll_001, TestSize.Level1)
+{
+    auto queue = std::make_shared<SaveQueue>();
+    auto held = std::make_shared<SaveQueue::Done>();
+    auto started = std::make_shared<Started>(WAIT_TIME, false);
+    auto firstResult = std::make_shared<Result>(WAIT_TIME, ERR_DB_GET_FAIL);
+    queue->Submit("session", WAIT_TIME, Hold(held, started), Record(firstResult));
+    auto secondResult = std::make_shared<Result>(WAIT_TIME, ERR_DB_GET_FAIL);
+    queue->Submit("session", WAIT_TIME, Answer(SUCCESS), Record(secondResult));
+    ASSERT_TRUE(started->GetValue());
+    queue->CancelAll("session");
+    EXPECT_EQ(firstResult->GetValue(), ERR_CANCELED);
+    EXPECT_EQ(secondResult->GetValue(), ERR_CANCELED);
+    (*held)(SUCCESS);
+    EXPECT_EQ(queue->GetPendingCount("session"), 0);
+}
+}
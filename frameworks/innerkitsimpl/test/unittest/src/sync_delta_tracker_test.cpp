@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "sync_delta_tracker.h"
+
+using namespace testing::ext;
+using namespace OHOS::ObjectStore;
+using namespace OHOS;
+using namespace std;
+
+namespace {
+class SyncDeltaTrackerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void SyncDeltaTrackerTest::SetUpTestCase(void)
+{
+    // input testsuit setup step，setup invoked before all testcases
+}
+
+void SyncDeltaTrackerTest::TearDownTestCase(void)
+{
+    // input testsuit teardown step，teardown invoked after all testcases
+}
+
+void SyncDeltaTrackerTest::SetUp(void)
+{
+    // input testcase setup step，setup invoked before each testcases
+}
+
+void SyncDeltaTrackerTest::TearDown(void)
+{
+    // input testcase teardown step，teardown invoked after each testcases
+}
+
+/**
+ * @tc.name: GetPending_001
+ * @tc.desc: Test a device never synced has all written entries pending
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncDeltaTrackerTest, GetPending_001, TestSize.Level1)
+{
+    SyncDeltaTracker tracker;
+    tracker.OnWritten({ { "name", { 'T', 'o', 'm' } }, { "age", { 1 } } });
+    auto delta = tracker.GetPending({ "deviceA" });
+    EXPECT_EQ(delta.seq, 2);
+    EXPECT_EQ(delta.entries, 2);
+    EXPECT_EQ(delta.bytes, 11);
+}
+
+/**
+ * @tc.name: GetPending_002
+ * @tc.desc: Test a push to several devices counts the pending entries of each one
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncDeltaTrackerTest, GetPending_002, TestSize.Level1)
+{
+    SyncDeltaTracker tracker;
+    tracker.OnWritten({ { "name", { 'T', 'o', 'm' } }, { "age", { 1 } } });
+    auto delta = tracker.GetPending({ "deviceA", "deviceB" });
+    EXPECT_EQ(delta.entries, 4);
+    EXPECT_EQ(delta.bytes, 22);
+}
+
+/**
+ * @tc.name: GetPending_003
+ * @tc.desc: Test an acknowledged device only has the entries written after its acknowledgement pending
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncDeltaTrackerTest, GetPending_003, TestSize.Level1)
+{
+    SyncDeltaTracker tracker;
+    tracker.OnWritten({ { "name", { 'T', 'o', 'm' } }, { "age", { 1 } } });
+    tracker.Acknowledge("deviceA", tracker.GetPending({ "deviceA" }).seq);
+    tracker.OnWritten({ { "age", { 2 } } });
+    auto delta = tracker.GetPending({ "deviceA" });
+    EXPECT_EQ(delta.entries, 1);
+    EXPECT_EQ(delta.bytes, 4);
+}
+
+/**
+ * @tc.name: GetPending_004
+ * @tc.desc: Test a key written twice is pending once
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncDeltaTrackerTest, GetPending_004, TestSize.Level1)
+{
+    SyncDeltaTracker tracker;
+    tracker.OnWritten({ { "age", { 1 } } });
+    tracker.OnWritten({ { "age", { 2 } } });
+    auto delta = tracker.GetPending({ "deviceA" });
+    EXPECT_EQ(delta.entries, 1);
+    EXPECT_EQ(delta.bytes, 4);
+}
+
+/**
+ * @tc.name: Acknowledge_001
+ * @tc.desc: Test a late acknowledgement of an older push does not make entries pending again
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncDeltaTrackerTest, Acknowledge_001, TestSize.Level1)
+{
+    SyncDeltaTracker tracker;
+    tracker.OnWritten({ { "name", { 'T', 'o', 'm' } } });
+    uint64_t first = tracker.GetPending({ "deviceA" }).seq;
+    tracker.OnWritten({ { "age", { 1 } } });
+    tracker.Acknowledge("deviceA", tracker.GetPending({ "deviceA" }).seq);
+    tracker.Acknowledge("deviceA", first);
+    EXPECT_EQ(tracker.GetPending({ "deviceA" }).entries, 0);
+}
+
+/**
+ * @tc.name: OnPushed_001
+ * @tc.desc: Test pushes add up in the stats and the last one is kept apart
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncDeltaTrackerTest, OnPushed_001, TestSize.Level1)
+{
+    SyncDeltaTracker tracker;
+    tracker.OnPushed({ .seq = 2, .entries = 4, .bytes = 22 });
+    tracker.OnPushed({ .seq = 3, .entries = 3, .bytes = 15 });
+    SyncStats stats = tracker.GetStats();
+    EXPECT_EQ(stats.pushCount, 2);
+    EXPECT_EQ(stats.entryCount, 7);
+    EXPECT_EQ(stats.byteCount, 37);
+    EXPECT_EQ(stats.lastEntryCount, 3);
+    EXPECT_EQ(stats.lastByteCount, 15);
+}
+
+/**
+ * @tc.name: OnPulled_001
+ * @tc.desc: Test pulls are counted without changing the pushed counts
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncDeltaTrackerTest, OnPulled_001, TestSize.Level1)
+{
+    SyncDeltaTracker tracker;
+    tracker.OnPulled();
+    SyncStats stats = tracker.GetStats();
+    EXPECT_EQ(stats.pullCount, 1);
+    EXPECT_EQ(stats.pushCount, 0);
+    EXPECT_EQ(stats.entryCount, 0);
+}
+}
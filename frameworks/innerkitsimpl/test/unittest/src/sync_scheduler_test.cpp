@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "sync_scheduler.h"
+
+#include "block_data.h"
+#include "objectstore_errors.h"
+
+using namespace testing::ext;
+using namespace OHOS::ObjectStore;
+using namespace OHOS;
+using namespace std;
+
+namespace {
+class SyncSchedulerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void SyncSchedulerTest::SetUpTestCase(void)
+{
+    // input testsuit setup step，setup invoked before all testcases
+}
+
+void SyncSchedulerTest::TearDownTestCase(void)
+{
+    // input testsuit teardown step，teardown invoked after all testcases
+}
+
+void SyncSchedulerTest::SetUp(void)
+{
+    // input testcase setup step，setup invoked before each testcases
+}
+
+void SyncSchedulerTest::TearDown(void)
+{
+    // input testcase teardown step，teardown invoked after each testcases
+}
+
+// Records the done callback of each started sync and the name of the last one started.
+class SyncRecorder {
+public:
+    SyncScheduler::Task MakeTask(const std::string &name, uint32_t status = SUCCESS)
+    {
+        return [this, name, status](const SyncScheduler::Done &done) -> uint32_t {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                dones_[name] = done;
+            }
+            started_.SetValue(name);
+            return status;
+        };
+    }
+
+    std::string WaitStarted()
+    {
+        std::string name = started_.GetValue();
+        started_.Clear("");
+        return name;
+    }
+
+    void Finish(const std::string &name, bool succeeded)
+    {
+        SyncScheduler::Done done;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done = dones_[name];
+        }
+        done(succeeded);
+    }
+
+private:
+    std::mutex mutex_;
+    std::map<std::string, SyncScheduler::Done> dones_;
+    BlockData<std::string> started_ { 1, "" };
+};
+
+/**
+ * @tc.name: Submit_001
+ * @tc.desc: Test a sync with a free device starts right away
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Submit_001, TestSize.Level1)
+{
+    auto scheduler = std::make_shared<SyncScheduler>(1, 10, 10000);
+    SyncRecorder recorder;
+    scheduler->Submit("storeA", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("A"));
+    EXPECT_EQ(recorder.WaitStarted(), "A");
+    auto metrics = scheduler->GetMetrics();
+    EXPECT_EQ(metrics.submitted, 1);
+    EXPECT_EQ(metrics.started, 1);
+    EXPECT_EQ(metrics.running, 1);
+    recorder.Finish("A", true);
+    EXPECT_EQ(scheduler->GetMetrics().running, 0);
+}
+
+/**
+ * @tc.name: Submit_002
+ * @tc.desc: Test syncs with one device run one at a time
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Submit_002, TestSize.Level1)
+{
+    auto scheduler = std::make_shared<SyncScheduler>(1, 10, 10000);
+    SyncRecorder recorder;
+    scheduler->Submit("storeA", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("A"));
+    EXPECT_EQ(recorder.WaitStarted(), "A");
+    scheduler->Submit("storeB", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("B"));
+    auto metrics = scheduler->GetMetrics();
+    EXPECT_EQ(metrics.queueDepth, 1);
+    EXPECT_EQ(metrics.running, 1);
+    recorder.Finish("A", true);
+    EXPECT_EQ(recorder.WaitStarted(), "B");
+    recorder.Finish("B", true);
+}
+
+/**
+ * @tc.name: Submit_003
+ * @tc.desc: Test syncs with different devices do not wait for each other
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Submit_003, TestSize.Level1)
+{
+    auto scheduler = std::make_shared<SyncScheduler>(1, 10, 10000);
+    SyncRecorder recorder;
+    scheduler->Submit("storeA", "deviceA", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("A"));
+    EXPECT_EQ(recorder.WaitStarted(), "A");
+    scheduler->Submit("storeA", "deviceB", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("B"));
+    EXPECT_EQ(recorder.WaitStarted(), "B");
+    EXPECT_EQ(scheduler->GetMetrics().running, 2);
+    recorder.Finish("A", true);
+    recorder.Finish("B", true);
+}
+
+/**
+ * @tc.name: Submit_004
+ * @tc.desc: Test a waiting sync of high priority starts before an earlier one of low priority
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Submit_004, TestSize.Level1)
+{
+    auto scheduler = std::make_shared<SyncScheduler>(1, 10, 10000);
+    SyncRecorder recorder;
+    scheduler->Submit("storeA", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("A"));
+    EXPECT_EQ(recorder.WaitStarted(), "A");
+    scheduler->Submit("storeB", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("B"));
+    scheduler->Submit("storeC", "device", SyncScheduler::PRIORITY_HIGH, recorder.MakeTask("C"));
+    recorder.Finish("A", true);
+    EXPECT_EQ(recorder.WaitStarted(), "C");
+    recorder.Finish("C", true);
+    EXPECT_EQ(recorder.WaitStarted(), "B");
+    recorder.Finish("B", true);
+}
+
+/**
+ * @tc.name: Submit_005
+ * @tc.desc: Test a sync of a store that is already waiting is merged and runs the newer task
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Submit_005, TestSize.Level1)
+{
+    auto scheduler = std::make_shared<SyncScheduler>(1, 10, 10000);
+    SyncRecorder recorder;
+    scheduler->Submit("storeA", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("A"));
+    EXPECT_EQ(recorder.WaitStarted(), "A");
+    scheduler->Submit("storeB", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("B"));
+    scheduler->Submit("storeB", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("B2"));
+    auto metrics = scheduler->GetMetrics();
+    EXPECT_EQ(metrics.submitted, 3);
+    EXPECT_EQ(metrics.deduplicated, 1);
+    EXPECT_EQ(metrics.queueDepth, 1);
+    recorder.Finish("A", true);
+    EXPECT_EQ(recorder.WaitStarted(), "B2");
+    recorder.Finish("B2", true);
+    EXPECT_EQ(scheduler->GetMetrics().started, 2);
+}
+
+/**
+ * @tc.name: Submit_006
+ * @tc.desc: Abnormal test for Submit, the task is nullptr or the priority is invalid
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Submit_006, TestSize.Level1)
+{
+    auto scheduler = std::make_shared<SyncScheduler>(1, 10, 10000);
+    SyncRecorder recorder;
+    scheduler->Submit("storeA", "device", SyncScheduler::PRIORITY_LOW, nullptr);
+    scheduler->Submit("storeA", "device", SyncScheduler::PRIORITY_BUTT, recorder.MakeTask("A"));
+    auto metrics = scheduler->GetMetrics();
+    EXPECT_EQ(metrics.submitted, 0);
+    EXPECT_EQ(metrics.queueDepth, 0);
+    EXPECT_EQ(metrics.running, 0);
+}
+
+/**
+ * @tc.name: Finish_001
+ * @tc.desc: Test a failed sync is retried after a delay
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Finish_001, TestSize.Level1)
+{
+    auto scheduler = std::make_shared<SyncScheduler>(1, 10, 10000);
+    SyncRecorder recorder;
+    scheduler->Submit("storeA", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("A"));
+    EXPECT_EQ(recorder.WaitStarted(), "A");
+    recorder.Finish("A", false);
+    EXPECT_EQ(recorder.WaitStarted(), "A");
+    recorder.Finish("A", true);
+    auto metrics = scheduler->GetMetrics();
+    EXPECT_EQ(metrics.started, 2);
+    EXPECT_EQ(metrics.retried, 1);
+    EXPECT_EQ(metrics.failed, 0);
+}
+
+/**
+ * @tc.name: Finish_002
+ * @tc.desc: Test a sync that cannot be started is dropped without a retry and frees its slot
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, Finish_002, TestSize.Level1)
+{
+    auto scheduler = std::make_shared<SyncScheduler>(1, 10, 10000);
+    SyncRecorder recorder;
+    scheduler->Submit("storeA", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("A", ERR_DB_NOT_EXIST));
+    EXPECT_EQ(recorder.WaitStarted(), "A");
+    scheduler->Submit("storeB", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("B"));
+    EXPECT_EQ(recorder.WaitStarted(), "B");
+    recorder.Finish("B", true);
+    auto metrics = scheduler->GetMetrics();
+    EXPECT_EQ(metrics.retried, 0);
+    EXPECT_EQ(metrics.failed, 1);
+}
+
+/**
+ * @tc.name: OnTimeout_001
+ * @tc.desc: Test a timed out sync keeps its slot until it completes
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, OnTimeout_001, TestSize.Level1)
+{
+    constexpr uint32_t timeout = 200;
+    auto scheduler = std::make_shared<SyncScheduler>(1, 10, timeout);
+    SyncRecorder recorder;
+    scheduler->Submit("storeA", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("A"));
+    EXPECT_EQ(recorder.WaitStarted(), "A");
+    scheduler->Submit("storeB", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("B"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(timeout + timeout / 2));
+    auto metrics = scheduler->GetMetrics();
+    EXPECT_EQ(metrics.timedOut, 1);
+    EXPECT_EQ(metrics.running, 1);
+    EXPECT_EQ(metrics.queueDepth, 1);
+    recorder.Finish("A", true);
+    EXPECT_EQ(recorder.WaitStarted(), "B");
+    recorder.Finish("B", true);
+    metrics = scheduler->GetMetrics();
+    EXPECT_EQ(metrics.retried, 0);
+    EXPECT_EQ(metrics.running, 0);
+}
+
+/**
+ * @tc.name: OnTimeout_002
+ * @tc.desc: Test a sync that has not completed after its second timeout is given up without a retry
+ * @tc.type: FUNC
+ */
+HWTEST_F(SyncSchedulerTest, OnTimeout_002, TestSize.Level1)
+{
+    constexpr uint32_t timeout = 200;
+    auto scheduler = std::make_shared<SyncScheduler>(1, 10, timeout);
+    SyncRecorder recorder;
+    scheduler->Submit("storeA", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("A"));
+    EXPECT_EQ(recorder.WaitStarted(), "A");
+    scheduler->Submit("storeB", "device", SyncScheduler::PRIORITY_LOW, recorder.MakeTask("B"));
+    EXPECT_EQ(recorder.WaitStarted(), "B");
+    auto metrics = scheduler->GetMetrics();
+    EXPECT_EQ(metrics.timedOut, 1);
+    EXPECT_EQ(metrics.failed, 1);
+    EXPECT_EQ(metrics.retried, 0);
+    recorder.Finish("A", true);
+    recorder.Finish("B", true);
+    EXPECT_EQ(scheduler->GetMetrics().running, 0);
+}
+}
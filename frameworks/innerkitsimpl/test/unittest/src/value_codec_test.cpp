@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "value_codec.h"
+
+#include "bytes_utils.h"
+#include "objectstore_errors.h"
+
+using namespace testing::ext;
+using namespace OHOS::ObjectStore;
+using namespace OHOS;
+using namespace std;
+
+namespace {
+class ValueCodecTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void ValueCodecTest::SetUpTestCase(void)
+{
+    // input testsuit setup step，setup invoked before all testcases
+}
+
+void ValueCodecTest::TearDownTestCase(void)
+{
+    // input testsuit teardown step，teardown invoked after all testcases
+}
+
+void ValueCodecTest::SetUp(void)
+{
+    // input testcase setup step，setup invoked before each testcases
+}
+
+void ValueCodecTest::TearDown(void)
+{
+    // input testcase teardown step，teardown invoked after each testcases
+}
+
+/**
+ * @tc.name: EncodeDouble_001
+ * @tc.desc: Test a double is written in the layout of BytesUtils and read back
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCodecTest, EncodeDouble_001, TestSize.Level1)
+{
+    double salary = 100.5;
+    Bytes legacy;
+    Type type = TYPE_DOUBLE;
+    BytesUtils::PutNum(&type, 0, sizeof(type), legacy);
+    BytesUtils::PutNum(&salary, sizeof(type), sizeof(salary), legacy);
+    EXPECT_EQ(ValueCodec::EncodeDouble(salary), legacy);
+    double decoded = 0;
+    EXPECT_EQ(ValueCodec::DecodeDouble(legacy, decoded), SUCCESS);
+    EXPECT_EQ(decoded, salary);
+}
+
+/**
+ * @tc.name: EncodeBoolean_001
+ * @tc.desc: Test a boolean is written in the layout of BytesUtils
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCodecTest, EncodeBoolean_001, TestSize.Level1)
+{
+    bool flag = true;
+    Bytes legacy;
+    Type type = TYPE_BOOLEAN;
+    BytesUtils::PutNum(&type, 0, sizeof(type), legacy);
+    BytesUtils::PutNum(&flag, sizeof(type), sizeof(flag), legacy);
+    EXPECT_EQ(ValueCodec::EncodeBoolean(flag), legacy);
+}
+
+/**
+ * @tc.name: Decode_001
+ * @tc.desc: Test a string is decoded into the string alternative
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCodecTest, Decode_001, TestSize.Level1)
+{
+    DecodedValue value;
+    EXPECT_EQ(ValueCodec::Decode(ValueCodec::EncodeString("Tom"), value), SUCCESS);
+    EXPECT_EQ(std::get<std::string>(value), "Tom");
+}
+
+/**
+ * @tc.name: Decode_002
+ * @tc.desc: Test a complex value is decoded into the alternative of its type tag
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCodecTest, Decode_002, TestSize.Level1)
+{
+    DecodedValue value;
+    Bytes complex = { 1, 2, 3 };
+    EXPECT_EQ(ValueCodec::Decode(ValueCodec::EncodeComplex(complex), value), SUCCESS);
+    EXPECT_EQ(value.index(), TYPE_COMPLEX);
+    EXPECT_EQ(std::get<std::vector<uint8_t>>(value), complex);
+}
+
+/**
+ * @tc.name: Decode_003
+ * @tc.desc: Abnormal test for Decode, data is empty
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCodecTest, Decode_003, TestSize.Level1)
+{
+    DecodedValue value;
+    EXPECT_EQ(ValueCodec::Decode(Bytes(), value), ERR_DATA_LEN);
+}
+
+/**
+ * @tc.name: Decode_004
+ * @tc.desc: Abnormal test for Decode, a double is truncated
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCodecTest, Decode_004, TestSize.Level1)
+{
+    DecodedValue value;
+    EXPECT_EQ(ValueCodec::Decode(Bytes{ TYPE_DOUBLE, 1 }, value), ERR_DATA_LEN);
+}
+
+/**
+ * @tc.name: Decode_005
+ * @tc.desc: Abnormal test for Decode, the tag is not one of Type
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCodecTest, Decode_005, TestSize.Level1)
+{
+    DecodedValue value;
+    EXPECT_EQ(ValueCodec::Decode(ValueCodec::EncodeVarint(1), value), ERR_DATA_LEN);
+}
+
+/**
+ * @tc.name: EncodeVarint_001
+ * @tc.desc: Test varints of both signs and the limits are read back unchanged
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCodecTest, EncodeVarint_001, TestSize.Level1)
+{
+    for (int64_t number : { int64_t(0), int64_t(-1), int64_t(300), INT64_MIN, INT64_MAX }) {
+        int64_t result = 0;
+        EXPECT_EQ(ValueCodec::DecodeVarint(ValueCodec::EncodeVarint(number), result), SUCCESS);
+        EXPECT_EQ(result, number);
+    }
+}
+
+/**
+ * @tc.name: EncodeVarint_002
+ * @tc.desc: Test a small negative varint takes one byte after the tag
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCodecTest, EncodeVarint_002, TestSize.Level1)
+{
+    EXPECT_EQ(ValueCodec::EncodeVarint(-1).size(), 2);
+}
+
+/**
+ * @tc.name: DecodeVarint_001
+ * @tc.desc: Abnormal test for DecodeVarint, the varint is not terminated
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCodecTest, DecodeVarint_001, TestSize.Level1)
+{
+    int64_t number = 0;
+    EXPECT_EQ(ValueCodec::DecodeVarint(Bytes{ ValueCodec::TAG_VARINT, 0x80 }, number), ERR_DATA_LEN);
+}
+}
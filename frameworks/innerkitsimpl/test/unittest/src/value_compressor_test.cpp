@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "value_compressor.h"
+
+#include "objectstore_errors.h"
+#include "value_codec.h"
+
+using namespace testing::ext;
+using namespace OHOS::ObjectStore;
+using namespace OHOS;
+using namespace std;
+
+namespace {
+class ValueCompressorTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void ValueCompressorTest::SetUpTestCase(void)
+{
+    // input testsuit setup step，setup invoked before all testcases
+}
+
+void ValueCompressorTest::TearDownTestCase(void)
+{
+    // input testsuit teardown step，teardown invoked after all testcases
+}
+
+void ValueCompressorTest::SetUp(void)
+{
+    // input testcase setup step，setup invoked before each testcases
+}
+
+void ValueCompressorTest::TearDown(void)
+{
+    // input testcase teardown step，teardown invoked after each testcases
+}
+
+Bytes MakeCompressed(uint64_t len, const Bytes &block)
+{
+    Bytes data = { ValueCodec::TAG_COMPRESSED };
+    ValueCodec::PutVarint(len, data);
+    data.insert(data.end(), block.begin(), block.end());
+    return data;
+}
+
+/**
+ * @tc.name: Compress_001
+ * @tc.desc: Test a compressible value round trips and a small or truncated one is rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCompressorTest, Compress_001, TestSize.Level1)
+{
+    std::string document;
+    for (int i = 0; i < 100; i++) {
+        document += "{\"name\":\"Tom\",\"age\":" + std::to_string(i) + "},";
+    }
+    Bytes encoded = ValueCodec::EncodeString(document);
+    Bytes compressed;
+    ASSERT_TRUE(ValueCompressor::Compress(encoded, compressed));
+    EXPECT_TRUE(ValueCompressor::IsCompressed(compressed));
+    EXPECT_LT(compressed.size(), encoded.size());
+    Bytes restored;
+    EXPECT_EQ(ValueCompressor::Decompress(compressed, restored), SUCCESS);
+    EXPECT_EQ(restored, encoded);
+    compressed.resize(compressed.size() - 1);
+    EXPECT_EQ(ValueCompressor::Decompress(compressed, restored), ERR_DATA_LEN);
+    EXPECT_FALSE(ValueCompressor::Compress(ValueCodec::EncodeString("Tom"), compressed));
+    EXPECT_FALSE(ValueCompressor::IsCompressed(encoded));
+    EXPECT_EQ(ValueCompressor::Decompress(encoded, restored), ERR_DATA_LEN);
+}
+
+/**
+ * @tc.name: Compress_002
+ * @tc.desc: Test a run of one byte compresses into matches overlapping their output and round trips
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCompressorTest, Compress_002, TestSize.Level1)
+{
+    Bytes encoded = ValueCodec::EncodeString(std::string(1000, 'a'));
+    Bytes compressed;
+    ASSERT_TRUE(ValueCompressor::Compress(encoded, compressed));
+    EXPECT_LT(compressed.size(), encoded.size() / 10);
+    Bytes restored;
+    EXPECT_EQ(ValueCompressor::Decompress(compressed, restored), SUCCESS);
+    EXPECT_EQ(restored, encoded);
+}
+
+/**
+ * @tc.name: Decompress_001
+ * @tc.desc: Test a match longer than its offset repeats the bytes it produces
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCompressorTest, Decompress_001, TestSize.Level1)
+{
+    // One literal, a match of 8 at offset 1, then one last literal.
+    Bytes restored;
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(10, { 0x14, 'a', 1, 0, 0x10, 'b' }), restored), SUCCESS);
+    EXPECT_EQ(restored, Bytes({ 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'b' }));
+    // Two literals, a match of 6 at offset 2.
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(9, { 0x22, 'a', 'b', 2, 0, 0x10, 'c' }), restored),
+        SUCCESS);
+    EXPECT_EQ(restored, Bytes({ 'a', 'b', 'a', 'b', 'a', 'b', 'a', 'b', 'c' }));
+}
+
+/**
+ * @tc.name: Decompress_002
+ * @tc.desc: Test a match at offset 0 or before the start of the output is rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCompressorTest, Decompress_002, TestSize.Level1)
+{
+    Bytes restored;
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(6, { 0x10, 'a', 0, 0, 0x10, 'b' }), restored),
+        ERR_DATA_LEN);
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(6, { 0x10, 'a', 2, 0, 0x10, 'b' }), restored),
+        ERR_DATA_LEN);
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(6, { 0x10, 'a', 0xFF, 0xFF, 0x10, 'b' }), restored),
+        ERR_DATA_LEN);
+    // A match running past the declared length.
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(4, { 0x10, 'a', 1, 0, 0x10, 'b' }), restored),
+        ERR_DATA_LEN);
+    EXPECT_TRUE(restored.empty());
+}
+
+/**
+ * @tc.name: Decompress_003
+ * @tc.desc: Test a missing, zero, oversized or overlong decompressed length is rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCompressorTest, Decompress_003, TestSize.Level1)
+{
+    Bytes restored;
+    EXPECT_EQ(ValueCompressor::Decompress(Bytes({ ValueCodec::TAG_COMPRESSED }), restored), ERR_DATA_LEN);
+    EXPECT_EQ(ValueCompressor::Decompress(Bytes({ ValueCodec::TAG_COMPRESSED, 0x80 }), restored), ERR_DATA_LEN);
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(0, { 0x00 }), restored), ERR_DATA_LEN);
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(ValueCompressor::MAX_VALUE_LEN + 1, { 0x10, 'a' }),
+        restored), ERR_DATA_LEN);
+    // A length that goes on past its fifth varint byte does not fit in 32 bits.
+    Bytes overlong = { ValueCodec::TAG_COMPRESSED, 0x81, 0x80, 0x80, 0x80, 0x80, 0x00, 0x10, 'a' };
+    EXPECT_EQ(ValueCompressor::Decompress(overlong, restored), ERR_DATA_LEN);
+    EXPECT_TRUE(restored.empty());
+}
+
+/**
+ * @tc.name: Decompress_004
+ * @tc.desc: Test literal and match length extensions that overflow or run past the input are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCompressorTest, Decompress_004, TestSize.Level1)
+{
+    Bytes restored;
+    // Enough 255 bytes to add up past MAX_VALUE_LEN, with more still following.
+    Bytes block(ValueCompressor::MAX_VALUE_LEN / 255 + 16, 0xFF);
+    block[0] = 0xF0;
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(16, block), restored), ERR_DATA_LEN);
+    block[0] = 0x1F;
+    block[1] = 'a';
+    block[2] = 1;
+    block[3] = 0;
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(16, block), restored), ERR_DATA_LEN);
+    // Extensions cut off by the end of the input.
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(16, { 0xF0, 0xFF, 0xFF }), restored), ERR_DATA_LEN);
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(16, { 0x1F, 'a', 1, 0, 0xFF }), restored), ERR_DATA_LEN);
+    EXPECT_TRUE(restored.empty());
+}
+
+/**
+ * @tc.name: Decompress_005
+ * @tc.desc: Test literal runs past the input or the output and blocks that end early are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValueCompressorTest, Decompress_005, TestSize.Level1)
+{
+    Bytes restored;
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(5, { 0x50, 'a', 'b', 'c' }), restored), ERR_DATA_LEN);
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(2, { 0x30, 'a', 'b', 'c' }), restored), ERR_DATA_LEN);
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(4, { 0x30, 'a', 'b', 'c' }), restored), ERR_DATA_LEN);
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(8, { 0x10, 'a', 1 }), restored), ERR_DATA_LEN);
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(8, { 0x10, 'a', 1, 0 }), restored), ERR_DATA_LEN);
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(3, {}), restored), ERR_DATA_LEN);
+    EXPECT_TRUE(restored.empty());
+    EXPECT_EQ(ValueCompressor::Decompress(MakeCompressed(3, { 0x30, 'a', 'b', 'c' }), restored), SUCCESS);
+    EXPECT_EQ(restored, Bytes({ 'a', 'b', 'c' }));
+}
+}
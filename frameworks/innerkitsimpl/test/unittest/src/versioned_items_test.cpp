@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "versioned_items.h"
+
+using namespace testing::ext;
+using namespace OHOS::ObjectStore;
+using namespace OHOS;
+using namespace std;
+
+namespace {
+class VersionedItemsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void VersionedItemsTest::SetUpTestCase(void)
+{
+    // input testsuit setup step，setup invoked before all testcases
+}
+
+void VersionedItemsTest::TearDownTestCase(void)
+{
+    // input testsuit teardown step，teardown invoked after all testcases
+}
+
+void VersionedItemsTest::SetUp(void)
+{
+    // input testcase setup step，setup invoked before each testcases
+}
+
+void VersionedItemsTest::TearDown(void)
+{
+    // input testcase teardown step，teardown invoked after each testcases
+}
+
+/**
+ * @tc.name: Get_001
+ * @tc.desc: Abnormal test for Get, the items are not loaded
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, Get_001, TestSize.Level1)
+{
+    VersionedItems items;
+    EXPECT_EQ(items.Get(), nullptr);
+    items.Put("a", { 1 });
+    EXPECT_EQ(items.Get(), nullptr);
+}
+
+/**
+ * @tc.name: Load_001
+ * @tc.desc: Test writes made before Load are applied over the initial scan
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, Load_001, TestSize.Level1)
+{
+    VersionedItems items;
+    items.Put({ { "b", { 2 } } }, { "a" });
+    items.Load({ { "a", { 1 } }, { "c", { 3 } } });
+    auto snapshot = items.Get();
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_EQ(snapshot->Find("a"), nullptr);
+    ASSERT_NE(snapshot->Find("b"), nullptr);
+    EXPECT_EQ(*snapshot->Find("b"), std::vector<uint8_t>({ 2 }));
+    EXPECT_EQ(snapshot->size, 2u);
+    EXPECT_EQ(snapshot->version, 1u);
+}
+
+/**
+ * @tc.name: Put_001
+ * @tc.desc: Test a snapshot taken by a reader stays unchanged while a writer publishes a new version
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, Put_001, TestSize.Level1)
+{
+    VersionedItems items;
+    items.Load({ { "b", { 2 } } });
+    auto first = items.Get();
+    items.Put("d", { 4 });
+    auto second = items.Get();
+    EXPECT_EQ(first->size, 1u);
+    EXPECT_EQ(first->Find("d"), nullptr);
+    EXPECT_EQ(second->size, 2u);
+    EXPECT_EQ(second->version, first->version + 1);
+    EXPECT_EQ(items.GetVersion(), second->version);
+}
+
+/**
+ * @tc.name: Put_002
+ * @tc.desc: Test a new version shares the unchanged values with the previous one
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, Put_002, TestSize.Level1)
+{
+    VersionedItems items;
+    items.Load({ { "b", { 2 } } });
+    auto first = items.Get();
+    items.Put("d", { 4 });
+    auto second = items.Get();
+    ASSERT_NE(first->Find("b"), nullptr);
+    EXPECT_EQ(first->Find("b"), second->Find("b"));
+}
+
+/**
+ * @tc.name: Put_003
+ * @tc.desc: Test many writes keep the delta of a snapshot smaller than the snapshot
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, Put_003, TestSize.Level1)
+{
+    VersionedItems items;
+    items.Load({});
+    constexpr uint8_t count = 100;
+    for (uint8_t i = 0; i < count; i++) {
+        items.Put(std::to_string(i), { i });
+    }
+    items.Put({ { "0", { 1 } } }, { "1" });
+    auto last = items.Get();
+    ASSERT_NE(last, nullptr);
+    EXPECT_EQ(last->size, count - 1u);
+    EXPECT_LT(last->delta.size(), last->size);
+    EXPECT_EQ(last->Find("1"), nullptr);
+    EXPECT_EQ(*last->Find("0"), std::vector<uint8_t>({ 1 }));
+}
+
+/**
+ * @tc.name: Put_004
+ * @tc.desc: Test a bounded instance going over the shared budget drops its snapshots
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, Put_004, TestSize.Level1)
+{
+    VersionedItems items;
+    items.Load({});
+    items.Put("big", std::vector<uint8_t>(VersionedItems::MAX_SHARED_BYTES));
+    EXPECT_TRUE(items.IsDropped());
+    EXPECT_EQ(items.Get(), nullptr);
+}
+
+/**
+ * @tc.name: Put_005
+ * @tc.desc: Test an unbounded instance keeps its snapshots whatever their size
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, Put_005, TestSize.Level1)
+{
+    VersionedItems items(false);
+    items.Load({});
+    items.Put("big", std::vector<uint8_t>(VersionedItems::MAX_SHARED_BYTES));
+    EXPECT_FALSE(items.IsDropped());
+    ASSERT_NE(items.Get(), nullptr);
+}
+
+/**
+ * @tc.name: ForEach_001
+ * @tc.desc: Test every item of a snapshot is visited once in key order
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, ForEach_001, TestSize.Level1)
+{
+    VersionedItems items;
+    items.Load({ { "b", { 2 } }, { "d", { 4 } } });
+    items.Put({ { "a", { 1 } }, { "c", { 3 } } }, { "d" });
+    auto snapshot = items.Get();
+    ASSERT_NE(snapshot, nullptr);
+    std::vector<std::string> keys;
+    snapshot->ForEach([&keys](const std::string &key, const std::vector<uint8_t> &) {
+        keys.push_back(key);
+        return true;
+    });
+    EXPECT_EQ(keys, std::vector<std::string>({ "a", "b", "c" }));
+}
+
+/**
+ * @tc.name: ForEach_002
+ * @tc.desc: Test the visit stops once the visitor returns false
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, ForEach_002, TestSize.Level1)
+{
+    VersionedItems items;
+    items.Load({ { "a", { 1 } }, { "b", { 2 } } });
+    auto snapshot = items.Get();
+    ASSERT_NE(snapshot, nullptr);
+    size_t visited = 0;
+    snapshot->ForEach([&visited](const std::string &, const std::vector<uint8_t> &) {
+        visited++;
+        return false;
+    });
+    EXPECT_EQ(visited, 1);
+}
+
+/**
+ * @tc.name: Reset_001
+ * @tc.desc: Test Reset drops the snapshots while one a reader holds stays readable
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, Reset_001, TestSize.Level1)
+{
+    VersionedItems items;
+    items.Load({ { "d", { 4 } } });
+    auto snapshot = items.Get();
+    items.Reset();
+    EXPECT_EQ(items.Get(), nullptr);
+    EXPECT_TRUE(items.IsDropped());
+    ASSERT_NE(snapshot->Find("d"), nullptr);
+    EXPECT_EQ(*snapshot->Find("d"), std::vector<uint8_t>({ 4 }));
+}
+
+/**
+ * @tc.name: Reset_002
+ * @tc.desc: Test writes after Reset are ignored
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, Reset_002, TestSize.Level1)
+{
+    VersionedItems items;
+    items.Load({});
+    items.Reset();
+    items.Put("a", { 1 });
+    items.Load({ { "a", { 1 } } });
+    EXPECT_EQ(items.Get(), nullptr);
+}
+
+/**
+ * @tc.name: Reload_001
+ * @tc.desc: Test a session dropped by the shared budget reloads its snapshots once the budget frees
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, Reload_001, TestSize.Level1)
+{
+    const size_t size = VersionedItems::MAX_SHARED_BYTES * 2 / 3;
+    VersionedItems first;
+    first.Load({ { "a", std::vector<uint8_t>(size) } });
+    ASSERT_NE(first.Get(), nullptr);
+    VersionedItems second;
+    second.Load({});
+    second.Put("b", { 1 });
+    uint64_t version = second.GetVersion();
+    second.Put("c", std::vector<uint8_t>(size));
+    EXPECT_TRUE(second.IsDropped());
+    EXPECT_FALSE(second.CanReload());
+    EXPECT_FALSE(second.Reload({ { "b", { 1 } }, { "c", std::vector<uint8_t>(size) } }));
+    first.Reset();
+    EXPECT_TRUE(second.CanReload());
+    EXPECT_TRUE(second.Reload({ { "b", { 1 } }, { "c", std::vector<uint8_t>(size) } }));
+    EXPECT_FALSE(second.IsDropped());
+    EXPECT_FALSE(second.CanReload());
+    auto snapshot = second.Get();
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_GE(snapshot->version, version);
+    ASSERT_NE(snapshot->Find("c"), nullptr);
+    second.Put("d", { 4 });
+    ASSERT_NE(second.Get()->Find("d"), nullptr);
+}
+
+/**
+ * @tc.name: Reload_002
+ * @tc.desc: Test snapshots dropped by Reset are not reloaded
+ * @tc.type: FUNC
+ */
+HWTEST_F(VersionedItemsTest, Reload_002, TestSize.Level1)
+{
+    VersionedItems items;
+    items.Load({});
+    items.Reset();
+    EXPECT_FALSE(items.CanReload());
+    EXPECT_FALSE(items.Reload({ { "a", { 1 } } }));
+    EXPECT_EQ(items.Get(), nullptr);
+}
+}
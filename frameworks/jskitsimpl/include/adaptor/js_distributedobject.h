@@ -30,6 +30,8 @@ public:
     static napi_value JSPut(napi_env env, napi_callback_info info);
     static napi_value JSSave(napi_env env, napi_callback_info info);
     static napi_value JSRevokeSave(napi_env env, napi_callback_info info);
+    static napi_value JSSetSyncPolicy(napi_env env, napi_callback_info info);
+    static napi_value JSCommit(napi_env env, napi_callback_info info);
     static napi_value JSBindAssetStore(napi_env env, napi_callback_info info);
     static napi_value GetCons(napi_env env);
 
@@ -38,14 +40,6 @@ private:
     static void DoGet(napi_env env, JSObjectWrapper *wrapper, char *key, napi_value &value);
     static napi_value GetSaveResultCons(napi_env env, std::string &sessionId, double version, std::string deviceId);
     static napi_value GetRevokeSaveResultCons(napi_env env, std::string &sessionId);
-    static void HandleStringType(
-        napi_env env, DistributedObject *object, const std::string &keyString, napi_value &value);
-    static void HandleDoubleType(
-        napi_env env, DistributedObject *object, const std::string &keyString, napi_value &value);
-    static void HandleBooleanType(
-        napi_env env, DistributedObject *object, const std::string &keyString, napi_value &value);
-    static void HandleComplexType(
-        napi_env env, DistributedObject *object, const std::string &keyString, napi_value &value);
 };
 } // namespace OHOS::ObjectStore
 
@@ -15,6 +15,7 @@
 #ifndef OHOS_JS_UTIL_H
 #define OHOS_JS_UTIL_H
 
+#include "distributed_object.h"
 #include "napi/native_node_api.h"
 #include "object_types.h"
 
@@ -52,6 +53,9 @@ public:
     static napi_status GetValue(napi_env env, napi_value in, std::vector<uint8_t> &out);
     static napi_status SetValue(napi_env env, const std::vector<uint8_t> &in, napi_value &out);
 
+    /* napi_value <- string or Uint8Array read straight from the stored bytes */
+    static napi_status SetValue(napi_env env, const ValueView &in, napi_value &out);
+
     static napi_status GetValue(napi_env env, napi_value in, Assets &assets);
 
     static napi_status GetValue(napi_env env, napi_value in, Asset &asset);
@@ -22,6 +22,8 @@ namespace OHOS::ObjectStore {
 using NapiCbInfoParser = std::function<void(size_t argc, napi_value *argv)>;
 using NapiAsyncExecute = std::function<void(void)>;
 using NapiAsyncComplete = std::function<void(napi_value &)>;
+using NapiAsyncDone = std::function<void(void)>;
+using NapiAsyncStart = std::function<void(const NapiAsyncDone &)>;
 static constexpr size_t ARGC_MAX = 6;
 struct ContextBase {
     virtual ~ContextBase();
@@ -83,6 +85,10 @@ class NapiQueue {
 public:
     static napi_value AsyncWork(napi_env env, std::shared_ptr<ContextBase> contextBase, const std::string &name,
         NapiAsyncExecute execute = NapiAsyncExecute(), NapiAsyncComplete complete = NapiAsyncComplete());
+    // Like AsyncWork for an operation that completes by itself instead of a blocking execute. start runs on the
+    // JS thread and has the operation call done once, from any thread, complete then runs on the JS thread.
+    static napi_value AsyncCall(napi_env env, std::shared_ptr<ContextBase> contextBase, const std::string &name,
+        NapiAsyncStart start, NapiAsyncComplete complete = NapiAsyncComplete());
     static void SetBusinessError(napi_env env, napi_value *businessError, std::shared_ptr<Error> error);
 
 private:
@@ -100,6 +106,7 @@ private:
         napi_async_work work = nullptr;
     };
     static void GenerateOutput(ContextBase *ctxt);
+    static void Output(ContextBase *ctxt);
 };
 } // namespace OHOS::ObjectStore
 #endif // OHOS_NAPI_QUEUE_H
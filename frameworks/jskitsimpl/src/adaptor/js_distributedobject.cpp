@@ -24,6 +24,14 @@
 namespace OHOS::ObjectStore {
 constexpr size_t KEY_SIZE = 64;
 
+// Sets the result of a save or revoke on its context, the same way for a callback and a promise.
+static void SetSaveStatus(ContextBase *ctxt, uint32_t status)
+{
+    INVALID_API_THROW_ERROR(status != ERR_PROCESSING);
+    INVALID_STATUS_THROW_ERROR(status == SUCCESS, "operation failed");
+    ctxt->status = napi_ok;
+}
+
 napi_value JSDistributedObject::JSConstructor(napi_env env, napi_callback_info info)
 {
     LOG_INFO("start");
@@ -109,6 +117,8 @@ napi_value JSDistributedObject::GetCons(napi_env env)
         DECLARE_NAPI_FUNCTION("get", JSDistributedObject::JSGet),
         DECLARE_NAPI_FUNCTION("save", JSDistributedObject::JSSave),
         DECLARE_NAPI_FUNCTION("revokeSave", JSDistributedObject::JSRevokeSave),
+        DECLARE_NAPI_FUNCTION("setSyncPolicy", JSDistributedObject::JSSetSyncPolicy),
+        DECLARE_NAPI_FUNCTION("commit", JSDistributedObject::JSCommit),
         DECLARE_NAPI_FUNCTION("bindAssetStore", JSDistributedObject::JSBindAssetStore),
     };
 
@@ -174,67 +184,11 @@ void JSDistributedObject::DoGet(napi_env env, JSObjectWrapper *wrapper, char *ke
         LOG_ERROR("object is nullptr");
         return;
     }
-    std::string keyString = key;
-    Type type = TYPE_STRING;
-    object->GetType(keyString, type);
-    LOG_DEBUG("get type %{public}s %{public}d", key, type);
-    switch (type) {
-        case TYPE_STRING:
-            HandleStringType(env, object, keyString, value);
-            break;
-        case TYPE_DOUBLE:
-            HandleDoubleType(env, object, keyString, value);
-            break;
-        case TYPE_BOOLEAN:
-            HandleBooleanType(env, object, keyString, value);
-            break;
-        case TYPE_COMPLEX:
-            HandleComplexType(env, object, keyString, value);
-            break;
-        default:
-            LOG_ERROR("error type! %{public}d", type);
-            break;
-    }
-}
-
-void JSDistributedObject::HandleStringType(
-    napi_env env, DistributedObject *object, const std::string &keyString, napi_value &value)
-{
-    std::string result;
-    uint32_t ret = object->GetString(keyString, result);
-    NOT_MATCH_RETURN_VOID(ret == SUCCESS);
-    napi_status status = JSUtil::SetValue(env, result, value);
-    NOT_MATCH_RETURN_VOID(status == napi_ok);
-}
-
-void JSDistributedObject::HandleDoubleType(
-    napi_env env, DistributedObject *object, const std::string &keyString, napi_value &value)
-{
-    double result;
-    uint32_t ret = object->GetDouble(keyString, result);
-    LOG_DEBUG("%{public}f", result);
-    NOT_MATCH_RETURN_VOID(ret == SUCCESS);
-    napi_status status = JSUtil::SetValue(env, result, value);
-    NOT_MATCH_RETURN_VOID(status == napi_ok);
-}
-
-void JSDistributedObject::HandleBooleanType(
-    napi_env env, DistributedObject *object, const std::string &keyString, napi_value &value)
-{
-    bool result;
-    uint32_t ret = object->GetBoolean(keyString, result);
-    LOG_DEBUG("%{public}d", result);
-    NOT_MATCH_RETURN_VOID(ret == SUCCESS);
-    napi_status status = JSUtil::SetValue(env, result, value);
-    NOT_MATCH_RETURN_VOID(status == napi_ok);
-}
-
-void JSDistributedObject::HandleComplexType(
-    napi_env env, DistributedObject *object, const std::string &keyString, napi_value &value)
-{
-    std::vector<uint8_t> result;
-    uint32_t ret = object->GetComplex(keyString, result);
+    // One read returns the type and the value, strings and complex values are not copied before napi.
+    ValueView result;
+    uint32_t ret = object->GetView(key, result);
     NOT_MATCH_RETURN_VOID(ret == SUCCESS);
+    LOG_DEBUG("get type %{public}s %{public}d", key, result.type);
     napi_status status = JSUtil::SetValue(env, result, value);
     NOT_MATCH_RETURN_VOID(status == napi_ok);
 }
@@ -265,15 +219,22 @@ napi_value JSDistributedObject::JSSave(napi_env env, napi_callback_info info)
     };
     ctxt->GetCbInfo(env, info, getCbOpe);
     NAPI_ASSERT_ERRCODE(env, ctxt->status != napi_invalid_arg, ctxt->error);
-    auto execute = [ctxt]() {
+    // The promise completes from the save callback, no worker thread waits for the service.
+    auto start = [ctxt](const NapiAsyncDone &done) {
         LOG_INFO("start");
-        CHECK_STATUS_RETURN_VOID(env, ctxt->wrapper != nullptr, ctxt, "wrapper is null");
-        CHECK_STATUS_RETURN_VOID(env, ctxt->wrapper->GetObject() != nullptr, ctxt, "object is null");
-        uint32_t status = ctxt->wrapper->GetObject()->Save(ctxt->deviceId);
-        INVALID_API_THROW_ERROR(status != ERR_PROCESSING);
-        INVALID_STATUS_THROW_ERROR(status == SUCCESS, "operation failed");
-        ctxt->status = napi_ok;
-        LOG_INFO("end");
+        DistributedObject *object = ctxt->wrapper != nullptr ? ctxt->wrapper->GetObject() : nullptr;
+        SaveId saveId = INVALID_SAVE_ID;
+        ContextBase *context = ctxt.get();
+        uint32_t status = object == nullptr ? ERR_NULL_OBJECT : object->SaveAsync(ctxt->deviceId,
+            DEFAULT_SAVE_TIMEOUT, [context, done](uint32_t result) {
+                SetSaveStatus(context, result);
+                LOG_INFO("end");
+                done();
+            }, saveId);
+        if (status != SUCCESS) {
+            SetSaveStatus(context, status);
+            done();
+        }
     };
     auto output = [env, ctxt](napi_value &result) {
         if (ctxt->status == napi_ok) {
@@ -285,7 +246,7 @@ napi_value JSDistributedObject::JSSave(napi_env env, napi_callback_info info)
             INVALID_STATUS_RETURN_ERROR(ctxt, "output failed!");
         }
     };
-    return NapiQueue::AsyncWork(env, ctxt, std::string(__FUNCTION__), execute, output);
+    return NapiQueue::AsyncCall(env, ctxt, std::string(__FUNCTION__), start, output);
 }
 
 // revokeSave(callback?:AsyncCallback<RevokeSaveSuccessResponse>): void;
@@ -309,14 +270,20 @@ napi_value JSDistributedObject::JSRevokeSave(napi_env env, napi_callback_info in
         napi_throw_error((env), std::to_string(ctxt->error->GetCode()).c_str(), ctxt->error->GetMessage().c_str());
         return nullptr;
     }
-    auto execute = [ctxt]() {
-        CHECK_STATUS_RETURN_VOID(env, ctxt->wrapper != nullptr, ctxt, "wrapper is null");
-        CHECK_STATUS_RETURN_VOID(env, ctxt->wrapper->GetObject() != nullptr, ctxt, "object is null");
-        uint32_t status = ctxt->wrapper->GetObject()->RevokeSave();
-        INVALID_API_THROW_ERROR(status != ERR_PROCESSING);
-        INVALID_STATUS_THROW_ERROR(status == SUCCESS, "operation failed");
-        ctxt->status = napi_ok;
-        LOG_INFO("end");
+    auto start = [ctxt](const NapiAsyncDone &done) {
+        DistributedObject *object = ctxt->wrapper != nullptr ? ctxt->wrapper->GetObject() : nullptr;
+        SaveId saveId = INVALID_SAVE_ID;
+        ContextBase *context = ctxt.get();
+        uint32_t status = object == nullptr ? ERR_NULL_OBJECT : object->RevokeSaveAsync(DEFAULT_SAVE_TIMEOUT,
+            [context, done](uint32_t result) {
+                SetSaveStatus(context, result);
+                LOG_INFO("end");
+                done();
+            }, saveId);
+        if (status != SUCCESS) {
+            SetSaveStatus(context, status);
+            done();
+        }
     };
     auto output = [env, ctxt](napi_value &result) {
         if (ctxt->status == napi_ok) {
@@ -328,7 +295,62 @@ napi_value JSDistributedObject::JSRevokeSave(napi_env env, napi_callback_info in
             INVALID_STATUS_RETURN_ERROR(ctxt, "output failed!");
         }
     };
-    return NapiQueue::AsyncWork(env, ctxt, std::string(__FUNCTION__), execute, output);
+    return NapiQueue::AsyncCall(env, ctxt, std::string(__FUNCTION__), start, output);
+}
+
+// setSyncPolicy(policy: SyncPolicy, window?: number): void;
+napi_value JSDistributedObject::JSSetSyncPolicy(napi_env env, napi_callback_info info)
+{
+    size_t requireArgc = 1;
+    size_t argc = 2;
+    napi_value argv[2] = { 0 };
+    napi_value thisVar = nullptr;
+    napi_status status = napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr);
+    NAPI_ASSERT_ERRCODE(env, status == napi_ok && argc >= requireArgc, std::make_shared<ParametersNum>("1 or 2"));
+    uint32_t policy = SYNC_AUTO;
+    status = JSUtil::GetValue(env, argv[0], policy);
+    NAPI_ASSERT_ERRCODE(env, status == napi_ok && policy <= SYNC_MANUAL,
+        std::make_shared<ParametersType>("policy", "SyncPolicy"));
+    uint32_t window = 0;
+    if (argc > requireArgc) {
+        status = JSUtil::GetValue(env, argv[1], window);
+        NAPI_ASSERT_ERRCODE(env, status == napi_ok, std::make_shared<ParametersType>("window", "number"));
+    }
+    JSObjectWrapper *wrapper = nullptr;
+    status = napi_unwrap(env, thisVar, (void **)&wrapper);
+    NOT_MATCH_RETURN_NULL(status == napi_ok && wrapper != nullptr && wrapper->GetObject() != nullptr);
+    uint32_t ret = wrapper->GetObject()->SetSyncPolicy(static_cast<SyncPolicy>(policy), window);
+    NAPI_ASSERT_ERRCODE(env, ret != ERR_INVALID_ARGS,
+        std::make_shared<ParametersType>("window", "number between 1 and 60000"));
+    NAPI_ASSERT_ERRCODE(env, ret == SUCCESS, std::make_shared<InnerError>());
+    return nullptr;
+}
+
+// commit(callback?:AsyncCallback<void>): void;
+// commit(): Promise<void>;
+napi_value JSDistributedObject::JSCommit(napi_env env, napi_callback_info info)
+{
+    LOG_DEBUG("JSCommit()");
+    struct CommitContext : public ContextBase {
+        JSObjectWrapper *wrapper;
+    };
+    auto ctxt = std::make_shared<CommitContext>();
+    std::function<void(size_t argc, napi_value * argv)> getCbOpe = [env, ctxt](size_t argc, napi_value *argv) {
+        JSObjectWrapper *wrapper = nullptr;
+        napi_status status = napi_unwrap(env, ctxt->self, (void **)&wrapper);
+        NOT_MATCH_RETURN_VOID(status == napi_ok && wrapper != nullptr && wrapper->GetObject() != nullptr);
+        ctxt->wrapper = wrapper;
+    };
+    ctxt->GetCbInfo(env, info, getCbOpe);
+    NAPI_ASSERT_ERRCODE(env, ctxt->status != napi_invalid_arg, ctxt->error);
+    auto execute = [ctxt]() {
+        CHECK_STATUS_RETURN_VOID(env, ctxt->wrapper != nullptr, ctxt, "wrapper is null");
+        CHECK_STATUS_RETURN_VOID(env, ctxt->wrapper->GetObject() != nullptr, ctxt, "object is null");
+        uint32_t status = ctxt->wrapper->GetObject()->Commit();
+        INVALID_STATUS_THROW_ERROR(status == SUCCESS, "operation failed");
+        ctxt->status = napi_ok;
+    };
+    return NapiQueue::AsyncWork(env, ctxt, std::string(__FUNCTION__), execute);
 }
 
 napi_value JSDistributedObject::GetSaveResultCons(
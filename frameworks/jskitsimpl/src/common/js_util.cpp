@@ -161,18 +161,43 @@ napi_status JSUtil::SetValue(napi_env env, const std::vector<uint8_t> &in, napi_
 {
     LOG_DEBUG("napi_value <- std::vector<uint8_t> ");
     LOG_ERROR_RETURN(in.size() > 0, "invalid std::vector<uint8_t>", napi_invalid_arg);
-    void *data = nullptr;
-    napi_value buffer = nullptr;
-    napi_status status = napi_create_arraybuffer(env, in.size(), &data, &buffer);
-    LOG_ERROR_RETURN((status == napi_ok), "create array buffer failed!", status);
+    ValueView view;
+    view.type = TYPE_COMPLEX;
+    view.data = in.data();
+    view.size = in.size();
+    return SetValue(env, view, out);
+}
 
-    if (memcpy_s(data, in.size(), in.data(), in.size()) != EOK) {
-        LOG_ERROR("memcpy_s not EOK");
-        return napi_invalid_arg;
+napi_status JSUtil::SetValue(napi_env env, const ValueView &in, napi_value &out)
+{
+    LOG_DEBUG("napi_value <- ValueView %{public}d", in.type);
+    LOG_ERROR_RETURN(in.data != nullptr && in.size > 0, "invalid ValueView", napi_invalid_arg);
+    switch (in.type) {
+        case TYPE_STRING:
+            return napi_create_string_utf8(env, reinterpret_cast<const char *>(in.data), in.size, &out);
+        case TYPE_DOUBLE:
+            LOG_ERROR_RETURN(in.size == sizeof(double), "invalid double ValueView", napi_invalid_arg);
+            return napi_create_double(env, *reinterpret_cast<const double *>(in.data), &out);
+        case TYPE_BOOLEAN:
+            LOG_ERROR_RETURN(in.size == sizeof(bool), "invalid boolean ValueView", napi_invalid_arg);
+            return napi_get_boolean(env, *reinterpret_cast<const bool *>(in.data), &out);
+        case TYPE_COMPLEX: {
+            void *data = nullptr;
+            napi_value buffer = nullptr;
+            napi_status status = napi_create_arraybuffer(env, in.size, &data, &buffer);
+            LOG_ERROR_RETURN((status == napi_ok), "create array buffer failed!", status);
+            if (memcpy_s(data, in.size, in.data, in.size) != EOK) {
+                LOG_ERROR("memcpy_s not EOK");
+                return napi_invalid_arg;
+            }
+            status = napi_create_typedarray(env, napi_uint8_array, in.size, buffer, 0, &out);
+            LOG_ERROR_RETURN((status == napi_ok), "napi_value <- ValueView invalid value", status);
+            return status;
+        }
+        default:
+            LOG_ERROR("ValueView type not supported %{public}d", in.type);
+            return napi_invalid_arg;
     }
-    status = napi_create_typedarray(env, napi_uint8_array, in.size(), buffer, 0, &out);
-    LOG_ERROR_RETURN((status == napi_ok), "napi_value <- std::vector<uint8_t> invalid value", status);
-    return status;
 }
 
 napi_status JSUtil::GetValue(napi_env env, napi_value in, AssetBindInfo &bindInfo)
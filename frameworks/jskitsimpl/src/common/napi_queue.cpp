@@ -115,6 +115,46 @@ napi_value NapiQueue::AsyncWork(napi_env env, std::shared_ptr<ContextBase> conte
     return promise;
 }
 
+napi_value NapiQueue::AsyncCall(napi_env env, std::shared_ptr<ContextBase> contextBase, const std::string &name,
+    NapiAsyncStart start, NapiAsyncComplete complete)
+{
+    auto ctxt = std::move(contextBase);
+    napi_value promise = nullptr;
+    if (ctxt->callbackRef == nullptr) {
+        napi_create_promise(ctxt->env, &ctxt->deferred, &promise);
+    } else {
+        napi_get_undefined(ctxt->env, &promise);
+    }
+    ctxt->complete = std::move(complete);
+    // The context holds itself until it is output, so that it is released on the JS thread.
+    ctxt->hold = ctxt;
+    ContextBase *context = ctxt.get();
+    std::string taskName = std::string("data_object.") + name;
+    NapiAsyncDone done = [context, taskName]() {
+        auto ret = napi_send_event(context->env, [context]() { Output(context); }, napi_eprio_high,
+            taskName.c_str());
+        if (ret != 0) {
+            LOG_ERROR("napi_send_event failed, ret: %{public}d.", ret);
+        }
+    };
+    if (start && ctxt->status == napi_ok) {
+        start(done);
+    } else {
+        Output(context);
+    }
+    return promise;
+}
+
+void NapiQueue::Output(ContextBase *ctxt)
+{
+    std::shared_ptr<ContextBase> hold = ctxt->hold;
+    if (ctxt->complete && ctxt->status == napi_ok) {
+        ctxt->complete(ctxt->output);
+    }
+    GenerateOutput(ctxt);
+    napi_delete_reference(ctxt->env, ctxt->callbackRef);
+}
+
 void NapiQueue::SetBusinessError(napi_env env, napi_value *businessError, std::shared_ptr<Error> error)
 {
     napi_create_object(env, businessError);
@@ -15,17 +15,74 @@
 
 #ifndef DISTRIBUTED_OBJECT_H
 #define DISTRIBUTED_OBJECT_H
+#include <functional>
+#include <map>
+#include <memory>
+#include <variant>
+
+#include "object_schema.h"
 #include "object_types.h"
+#include "objectstore_errors.h"
 
 namespace OHOS::ObjectStore {
-enum Type : uint8_t {
-    TYPE_STRING = 0,
-    TYPE_BOOLEAN,
-    TYPE_DOUBLE,
-    TYPE_COMPLEX,
+// Where the data of an object is kept. STORAGE_MEMORY objects live only in this process,
+// they are not synced between devices but can still be saved.
+enum StorageType : uint8_t {
+    STORAGE_DISTRIBUTED = 0,
+    STORAGE_MEMORY,
+};
+// When local changes of an object are pushed to the other devices.
+// SYNC_AUTO pushes after every write, SYNC_WINDOWED pushes the changes of a window together once it ends,
+// SYNC_MANUAL pushes only when Commit is called.
+enum SyncPolicy : uint8_t {
+    SYNC_AUTO = 0,
+    SYNC_WINDOWED,
+    SYNC_MANUAL,
+};
+// Syncs started for an object by this device. Pushes carry the entries written since the sync each device
+// acknowledged last, entryCount and byteCount add them up over all devices, byteCount counts keys and values.
+// Pulls are used when an object is created, what they bring in is not counted.
+struct SyncStats {
+    uint64_t pushCount = 0;
+    uint64_t pullCount = 0;
+    uint64_t entryCount = 0;
+    uint64_t byteCount = 0;
+    uint64_t lastEntryCount = 0;
+    uint64_t lastByteCount = 0;
+};
+// Completion of an asynchronous save or revoke, called once with its status on a thread of the object store.
+using SaveCallback = std::function<void(uint32_t status)>;
+// Identifies a submitted save or revoke until it completes.
+using SaveId = uint64_t;
+constexpr SaveId INVALID_SAVE_ID = 0;
+// Milliseconds a save or revoke may take from being submitted, including the wait for earlier ones of the object.
+constexpr uint32_t DEFAULT_SAVE_TIMEOUT = 5000;
+// Read-only view of a stored value. owner keeps the bytes alive, so the view stays valid after the value is
+// overwritten. For TYPE_STRING and TYPE_COMPLEX data is the payload without the type tag, for TYPE_BOOLEAN and
+// TYPE_DOUBLE it points at the native bool or double.
+struct ValueView {
+    Type type = TYPE_STRING;
+    std::shared_ptr<const void> owner;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+};
+// Property key resolved once by DistributedObject::GetPropertyHandle, equal keys share one instance.
+struct PropertyKey {
+    std::string key;
+    // The key as stored, with the field prefix.
+    std::string storedKey;
+    // A sub-field of an asset, writing it also updates the device id and the asset record state.
+    bool isAssetField = false;
 };
+// Puts and gets through a handle build no key, a handle can be used with every object of the same store.
+using PropertyHandle = std::shared_ptr<const PropertyKey>;
 class DistributedObject {
 public:
+    // Most entries one PutBatch writes, the limit of a single storage transaction.
+    static constexpr size_t MAX_BATCH_SIZE = 128;
+
+    // Methods added after the first release have default bodies returning ERR_NOT_SUPPORTED,
+    // so implementations written against the earlier interface keep compiling.
     virtual ~DistributedObject(){};
 
     /**
@@ -116,6 +173,137 @@ public:
      */
     virtual uint32_t GetComplex(const std::string &key, std::vector<uint8_t> &value) = 0;
 
+    /**
+     * @brief Get the data of any value type from the database according to the key without copying it,
+     * which means that the data of objects in the same sessionId is get.
+     *
+     * @param key Indicates the key of key-value data to get.
+     * @param value Indicates the type of the data and a view of its bytes.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t GetView(const std::string &key, ValueView &value)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Put or update the data a view points at, which is encoded straight from the viewed bytes.
+     *
+     * @param key Indicates the key of key-value data to put or update.
+     * @param value Indicates the type of the data and a view of its bytes, laid out as GetView returns them.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t PutView(const std::string &key, const ValueView &value)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Get the data of any value type from the database according to the key with a single read,
+     * which means that the data of objects in the same sessionId is get.
+     *
+     * @param key Indicates the key of key-value data to get.
+     * @param value Indicates the value of key-value data, its alternative is the value type.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t Get(const std::string &key, FieldValue &value)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Put or update several key-value data of any value type into the database in one transaction,
+     * which means that the data of objects in the same sessionId is put or updated together.
+     *
+     * @param values Indicates the key-value data to put or update, at most MAX_BATCH_SIZE of them.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t PutBatch(const std::map<std::string, FieldValue> &values)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Get several key-value data of any value type from the database according to the keys,
+     * which means that the data of objects in the same sessionId is get.
+     *
+     * @param keys Indicates the keys of key-value data to get.
+     * @param values Indicates the key-value data found, keys without data are left out.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t GetBatch(const std::vector<std::string> &keys, std::map<std::string, FieldValue> &values)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Get all key-value data of the object from the database with a single read.
+     *
+     * @param values Indicates all key-value data of the object.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t GetAll(std::map<std::string, FieldValue> &values)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Resolve the key of a property once, for repeated Put and Get of the same property.
+     *
+     * @param key Indicates the key of key-value data.
+     *
+     * @return Returns the handle of the property, nullptr for an empty key.
+     */
+    virtual PropertyHandle GetPropertyHandle(const std::string &key)
+    {
+        return nullptr;
+    }
+
+    /**
+     * @brief Put or update the data of any value type through a property handle.
+     *
+     * @param handle Indicates the handle returned by GetPropertyHandle.
+     * @param value Indicates the value of key-value data to put or update.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t Put(const PropertyHandle &handle, const FieldValue &value)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Get the data of any value type through a property handle.
+     *
+     * @param handle Indicates the handle returned by GetPropertyHandle.
+     * @param value Indicates the value of key-value data, its alternative is the value type.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t Get(const PropertyHandle &handle, FieldValue &value)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Get a read-only view of the data through a property handle, see GetView.
+     *
+     * @param handle Indicates the handle returned by GetPropertyHandle.
+     * @param value Indicates the view of the value.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t GetView(const PropertyHandle &handle, ValueView &value)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
     /**
      * @brief Get the value type of key-value data by the key
      *
@@ -142,6 +330,99 @@ public:
      */
     virtual uint32_t RevokeSave() = 0;
 
+    /**
+     * @brief Save the data to local device without waiting for the result.
+     * Saves and revokes of an object run one at a time in submit order, those of different objects run together.
+     *
+     * @param deviceId Indicates the device Id.
+     * @param timeout Indicates the milliseconds after which the save completes with ERR_TIMEOUT.
+     * @param callback Indicates the callback called with the result, only when 0 is returned.
+     * @param saveId Indicates the id to cancel the save with.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t SaveAsync(
+        const std::string &deviceId, uint32_t timeout, const SaveCallback &callback, SaveId &saveId)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Revoke save data without waiting for the result, ordered with the saves of the object.
+     *
+     * @param timeout Indicates the milliseconds after which the revoke completes with ERR_TIMEOUT.
+     * @param callback Indicates the callback called with the result, only when 0 is returned.
+     * @param saveId Indicates the id to cancel the revoke with.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t RevokeSaveAsync(uint32_t timeout, const SaveCallback &callback, SaveId &saveId)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Cancel a save or revoke, its callback is called with ERR_CANCELED.
+     * One already sent to the service is not undone, only no longer waited for. The next save or revoke of the
+     * object still starts after the service answers it, as after a timeout.
+     *
+     * @param saveId Indicates the id returned when it was submitted.
+     *
+     * @return Returns true if it had not completed yet.
+     */
+    virtual bool CancelSave(SaveId saveId)
+    {
+        return false;
+    }
+
+    /**
+     * @brief Set when local changes are synced to the other devices.
+     *
+     * @param policy Indicates the sync policy.
+     * @param window Indicates the length of a sync window in milliseconds, only used by SYNC_WINDOWED.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t SetSyncPolicy(SyncPolicy policy, uint32_t window)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Write all pending changes and push them to the other devices now.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t Commit()
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Get the counts of the syncs started for the object by this device.
+     *
+     * @param stats Indicates the sync counts.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t GetSyncStats(SyncStats &stats)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Get the version of the data of the object, which grows with every local or remote write.
+     * A watcher reading it when told of a change gets a version that includes the change.
+     *
+     * @param version Indicates the version.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t GetVersion(uint64_t &version)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
     /**
      * @brief Get the sessionId of the object.
      *
@@ -158,11 +439,78 @@ public:
      * @return Returns 0 for success, others for failure.
      */
     virtual uint32_t BindAssetStore(const std::string &assetKey, AssetBindInfo &bindInfo) = 0;
+
+    /**
+     * @brief Put a whole asset in one write, together with the sub-fields of each member read by older peers.
+     *
+     * @param assetKey Indicates the key of the asset.
+     * @param asset Indicates the asset, strings without the [STRING] prefix.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t PutAsset(const std::string &assetKey, const Asset &asset)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Get a whole asset in one read, an asset whose sub-fields changed without it is read from them.
+     *
+     * @param assetKey Indicates the key of the asset.
+     * @param asset Indicates the asset, strings without the [STRING] prefix.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t GetAsset(const std::string &assetKey, Asset &asset)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Declare the field types of the object, PutRecord and GetRecord then address fields by index.
+     *
+     * @param schema Indicates the schema, binding again may only append fields.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t BindSchema(const ObjectSchema &schema)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Put the fields of the bound schema in one write, as a record with a bit for each set field.
+     * Fields the record does not set keep their stored values.
+     *
+     * @param record Indicates the fields, each set one holding the type the schema declares.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t PutRecord(const SchemaRecord &record)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Get the fields of the bound schema in one read.
+     *
+     * @param record Indicates the fields, with the field count of the schema.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t GetRecord(SchemaRecord &record)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
 };
 
 class ObjectWatcher {
 public:
     virtual void OnChanged(const std::string &sessionid, const std::vector<std::string> &changedData) = 0;
+    // Called when the record written by PutRecord changed on this or another device, GetRecord reads it.
+    virtual void OnRecordChanged(const std::string &sessionId)
+    {
+    }
 };
 } // namespace OHOS::ObjectStore
 #endif // DISTRIBUTED_OBJECT_H
@@ -15,9 +15,11 @@
 
 #ifndef DISTRIBUTED_OBJECTSTORE_H
 #define DISTRIBUTED_OBJECTSTORE_H
+#include <functional>
 #include <string>
 
 #include "distributed_object.h"
+#include "objectstore_errors.h"
 
 namespace OHOS::ObjectStore {
 class StatusNotifier {
@@ -31,6 +33,10 @@ public:
 };
 class DistributedObjectStore {
 public:
+    using CreateCallback = std::function<void(DistributedObject *object, uint32_t status)>;
+
+    // Methods added after the first release have default bodies, so implementations written against
+    // the earlier interface keep compiling.
     virtual ~DistributedObjectStore(){};
 
     /**
@@ -62,6 +68,50 @@ public:
      */
     virtual DistributedObject *CreateObject(const std::string &sessionId, uint32_t &status) = 0;
 
+    /**
+     * @brief Create a object according to the sessionId, kept in the given kind of storage.
+     *
+     * @param sessionId Indicates the sessionId.
+     * @param storageType Indicates the storage of the object, see {@link StorageType}.
+     * @param status Indicates whether the distributed object is created successfully,
+     * 0 means success, other means fail.
+     *
+     * @return Returns the pointer to the DistributedObject class.
+     */
+    virtual DistributedObject *CreateObject(
+        const std::string &sessionId, StorageType storageType, uint32_t &status)
+    {
+        status = ERR_NOT_SUPPORTED;
+        return nullptr;
+    }
+
+    /**
+     * @brief Create a object according to the sessionId without blocking the calling thread.
+     *
+     * @param sessionId Indicates the sessionId.
+     * @param callback Indicates the callback invoked on a background thread with the created object
+     * and the status, 0 means success, other means fail.
+     */
+    virtual void CreateObjectAsync(const std::string &sessionId, const CreateCallback &callback)
+    {
+        if (callback != nullptr) {
+            callback(nullptr, ERR_NOT_SUPPORTED);
+        }
+    }
+
+    /**
+     * @brief Open the storage of a session in the background, so that a later CreateObject of
+     * the same sessionId does not have to wait for it. Unused storage is closed after a while.
+     *
+     * @param sessionId Indicates the sessionId.
+     *
+     * @return Returns 0 for success, others for failure.
+     */
+    virtual uint32_t PrepareObject(const std::string &sessionId)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
     /**
      * @brief Get the double pointer to the object.
      *
@@ -133,6 +183,17 @@ public:
      *
      */
     virtual void NotifyProgressStatus(const std::string &sessionId) = 0;
+
+    /**
+     * @brief Compress string and complex values larger than the threshold before they are stored and synced.
+     *
+     * Values written this way can only be read by devices that support compressed values.
+     *
+     * @param threshold Indicates the encoded size in bytes above which values are compressed, 0 disables it.
+     */
+    virtual void SetCompressThreshold(size_t threshold)
+    {
+    }
 };
 } // namespace OHOS::ObjectStore
 
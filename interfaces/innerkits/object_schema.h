@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECT_SCHEMA_H
+#define OBJECT_SCHEMA_H
+
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace OHOS::ObjectStore {
+enum Type : uint8_t {
+    TYPE_STRING = 0,
+    TYPE_BOOLEAN,
+    TYPE_DOUBLE,
+    TYPE_COMPLEX,
+};
+// A value of any Type, the index of the alternative it holds is its Type.
+using FieldValue = std::variant<std::string, bool, double, std::vector<uint8_t>>;
+
+// Field types of a schema-declared object, fields are identified by their index.
+// A later version may append fields but never reorder or retype them, so records of either version stay readable.
+struct ObjectSchema {
+    std::string name;
+    std::vector<Type> types;
+};
+
+// Fields of a schema-declared object, stored together in one record instead of one entry per field.
+class SchemaRecord {
+public:
+    SchemaRecord() = default;
+    explicit SchemaRecord(size_t fieldCount) : slots_(fieldCount)
+    {
+    }
+
+    size_t GetFieldCount() const
+    {
+        return slots_.size();
+    }
+
+    bool Has(size_t index) const
+    {
+        return index < slots_.size() && slots_[index].has_value();
+    }
+
+    // Returns nullptr for a field out of range or not set.
+    const FieldValue *Get(size_t index) const
+    {
+        return Has(index) ? &*slots_[index] : nullptr;
+    }
+
+    // Grows the record for a field past the end, the type is checked against the schema when put.
+    void Set(size_t index, FieldValue value)
+    {
+        if (index >= slots_.size()) {
+            slots_.resize(index + 1);
+        }
+        slots_[index] = std::move(value);
+    }
+
+    void Reset(size_t index)
+    {
+        if (index < slots_.size()) {
+            slots_[index].reset();
+        }
+    }
+
+private:
+    std::vector<std::optional<FieldValue>> slots_;
+};
+
+// Record whose field types are fixed at compile time, Fields are alternatives of FieldValue in schema order.
+// For example TypedRecord<std::string, double> note; note.Set<0>("title"); const double *mark = note.Get<1>();
+template<typename... Fields>
+class TypedRecord {
+public:
+    template<size_t I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+    static constexpr size_t FIELD_COUNT = sizeof...(Fields);
+
+    static ObjectSchema GetSchema(const std::string &name)
+    {
+        return { name, { TypeOf<Fields>()... } };
+    }
+
+    template<size_t I>
+    const FieldType<I> *Get() const
+    {
+        const FieldValue *value = record_.Get(I);
+        return value == nullptr ? nullptr : std::get_if<FieldType<I>>(value);
+    }
+
+    template<size_t I>
+    void Set(FieldType<I> value)
+    {
+        record_.Set(I, FieldValue(std::in_place_type<FieldType<I>>, std::move(value)));
+    }
+
+    template<size_t I>
+    void Reset()
+    {
+        record_.Reset(I);
+    }
+
+    SchemaRecord &GetRecord()
+    {
+        return record_;
+    }
+
+    const SchemaRecord &GetRecord() const
+    {
+        return record_;
+    }
+
+private:
+    template<typename T, size_t I = 0>
+    static constexpr Type TypeOf()
+    {
+        static_assert(I < std::variant_size_v<FieldValue>, "field type is not a FieldValue alternative");
+        if constexpr (std::is_same_v<T, std::variant_alternative_t<I, FieldValue>>) {
+            return static_cast<Type>(I);
+        } else {
+            return TypeOf<T, I + 1>();
+        }
+    }
+
+    SchemaRecord record_ = SchemaRecord(FIELD_COUNT);
+};
+} // namespace OHOS::ObjectStore
+#endif // OBJECT_SCHEMA_H
@@ -40,6 +40,8 @@ static constexpr const char* PATH_SUFFIX = ".path";
 static constexpr const char* CREATE_TIME_SUFFIX = ".createTime";
 static constexpr const char* MODIFY_TIME_SUFFIX = ".modifyTime";
 static constexpr const char* SIZE_SUFFIX = ".size";
+static constexpr const char* ID_SUFFIX = ".id";
+static constexpr const char* HASH_SUFFIX = ".hash";
 static constexpr const char* ASSET_DOT = ".";
 static const std::string DEVICEID_KEY = "__deviceId";
 } // namespace ObjectStore
@@ -138,6 +138,21 @@ constexpr uint32_t ERR_IPC = BASE_ERR_OFFSET + 22;
  * @brief No DATA_SYNC permission.
  */
 constexpr uint32_t ERR_NO_PERMISSION = BASE_ERR_OFFSET + 23;
+
+/**
+ * @brief The implementation does not provide the operation.
+ */
+constexpr uint32_t ERR_NOT_SUPPORTED = BASE_ERR_OFFSET + 24;
+
+/**
+ * @brief The operation did not complete before its deadline.
+ */
+constexpr uint32_t ERR_TIMEOUT = BASE_ERR_OFFSET + 25;
+
+/**
+ * @brief The operation was canceled.
+ */
+constexpr uint32_t ERR_CANCELED = BASE_ERR_OFFSET + 26;
 } // namespace OHOS::ObjectStore
 
 #endif
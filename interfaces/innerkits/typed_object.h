@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TYPED_OBJECT_H
+#define TYPED_OBJECT_H
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#if __has_include(<span>)
+#include <span>
+#endif
+
+#include "distributed_object.h"
+#include "objectstore_errors.h"
+
+namespace OHOS::ObjectStore {
+// Stored type and encoding of a C++ type, chosen at compile time:
+// bool is a TYPE_BOOLEAN, other arithmetic and enum types a TYPE_DOUBLE, std::string and std::string_view a
+// TYPE_STRING, byte vectors and spans a TYPE_COMPLEX and other trivially copyable structs a TYPE_COMPLEX holding
+// their object bytes. ToView and FromView convert without touching the store, a view made by ToView points into
+// the value. Get fails with ERR_DATA_LEN when the stored data does not fit the type.
+template<typename T, typename = void>
+struct FieldTraits;
+
+template<>
+struct FieldTraits<bool> {
+    static constexpr Type TYPE = TYPE_BOOLEAN;
+
+    static uint32_t Put(DistributedObject &object, const std::string &key, bool value)
+    {
+        return object.PutBoolean(key, value);
+    }
+
+    static uint32_t Get(DistributedObject &object, const std::string &key, bool &value)
+    {
+        return object.GetBoolean(key, value);
+    }
+};
+
+template<typename T>
+struct FieldTraits<T, std::enable_if_t<(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>>> {
+    static constexpr Type TYPE = TYPE_DOUBLE;
+
+    static uint32_t Put(DistributedObject &object, const std::string &key, T value)
+    {
+        return object.PutDouble(key, static_cast<double>(static_cast<Number>(value)));
+    }
+
+    static uint32_t Get(DistributedObject &object, const std::string &key, T &value)
+    {
+        double stored = 0;
+        uint32_t status = object.GetDouble(key, stored);
+        if (status != SUCCESS) {
+            return status;
+        }
+        return FromDouble(stored, value);
+    }
+
+    // Integers take only whole values in their range, those past 2^53 already lost precision when put.
+    static uint32_t FromDouble(double stored, T &value)
+    {
+        if constexpr (std::is_floating_point_v<Number>) {
+            value = static_cast<T>(stored);
+        } else {
+            double upper = std::ldexp(1.0, std::numeric_limits<Number>::digits);
+            double lower = std::is_signed_v<Number> ? -upper : 0;
+            if (!(stored >= lower && stored < upper) || std::trunc(stored) != stored) {
+                return ERR_DATA_LEN;
+            }
+            value = static_cast<T>(static_cast<Number>(stored));
+        }
+        return SUCCESS;
+    }
+
+private:
+    template<typename U, bool = std::is_enum_v<U>>
+    struct Underlying {
+        using type = U;
+    };
+    template<typename U>
+    struct Underlying<U, true> {
+        using type = std::underlying_type_t<U>;
+    };
+    using Number = typename Underlying<T>::type;
+};
+
+template<>
+struct FieldTraits<std::string_view> {
+    static constexpr Type TYPE = TYPE_STRING;
+
+    static ValueView ToView(std::string_view value)
+    {
+        return { TYPE, nullptr, reinterpret_cast<const uint8_t *>(value.data()), value.size() };
+    }
+
+    static uint32_t Put(DistributedObject &object, const std::string &key, std::string_view value)
+    {
+        return object.PutView(key, ToView(value));
+    }
+};
+
+template<>
+struct FieldTraits<std::string> {
+    static constexpr Type TYPE = TYPE_STRING;
+
+    static uint32_t FromView(const ValueView &view, std::string &value)
+    {
+        if (view.type != TYPE) {
+            return ERR_DATA_LEN;
+        }
+        value.assign(reinterpret_cast<const char *>(view.data), view.size);
+        return SUCCESS;
+    }
+
+    static uint32_t Put(DistributedObject &object, const std::string &key, const std::string &value)
+    {
+        return object.PutString(key, value);
+    }
+
+    static uint32_t Get(DistributedObject &object, const std::string &key, std::string &value)
+    {
+        ValueView view;
+        uint32_t status = object.GetView(key, view);
+        return status != SUCCESS ? status : FromView(view, value);
+    }
+};
+
+template<>
+struct FieldTraits<std::vector<uint8_t>> {
+    static constexpr Type TYPE = TYPE_COMPLEX;
+
+    static uint32_t Put(DistributedObject &object, const std::string &key, const std::vector<uint8_t> &value)
+    {
+        return object.PutComplex(key, value);
+    }
+
+    static uint32_t Get(DistributedObject &object, const std::string &key, std::vector<uint8_t> &value)
+    {
+        return object.GetComplex(key, value);
+    }
+};
+
+#ifdef __cpp_lib_span
+template<>
+struct FieldTraits<std::span<const uint8_t>> {
+    static constexpr Type TYPE = TYPE_COMPLEX;
+
+    static ValueView ToView(std::span<const uint8_t> value)
+    {
+        return { TYPE, nullptr, value.data(), value.size() };
+    }
+
+    static uint32_t Put(DistributedObject &object, const std::string &key, std::span<const uint8_t> value)
+    {
+        return object.PutView(key, ToView(value));
+    }
+};
+#endif
+
+template<typename T>
+struct IsTextOrBytes : std::false_type {};
+template<>
+struct IsTextOrBytes<std::string_view> : std::true_type {};
+#ifdef __cpp_lib_span
+template<typename U, size_t N>
+struct IsTextOrBytes<std::span<U, N>> : std::true_type {};
+#endif
+
+// The object bytes are stored as they are, only peers with the same layout and byte order can read them.
+template<typename T>
+struct FieldTraits<T, std::enable_if_t<std::is_class_v<T> && std::is_trivially_copyable_v<T> &&
+    !IsTextOrBytes<T>::value>> {
+    static constexpr Type TYPE = TYPE_COMPLEX;
+
+    static ValueView ToView(const T &value)
+    {
+        return { TYPE, nullptr, reinterpret_cast<const uint8_t *>(&value), sizeof(T) };
+    }
+
+    static uint32_t FromView(const ValueView &view, T &value)
+    {
+        if (view.type != TYPE || view.size != sizeof(T)) {
+            return ERR_DATA_LEN;
+        }
+        std::memcpy(&value, view.data, sizeof(T));
+        return SUCCESS;
+    }
+
+    static uint32_t Put(DistributedObject &object, const std::string &key, const T &value)
+    {
+        return object.PutView(key, ToView(value));
+    }
+
+    static uint32_t Get(DistributedObject &object, const std::string &key, T &value)
+    {
+        ValueView view;
+        uint32_t status = object.GetView(key, view);
+        return status != SUCCESS ? status : FromView(view, value);
+    }
+};
+
+template<typename T>
+uint32_t Put(DistributedObject &object, const std::string &key, const T &value)
+{
+    return FieldTraits<T>::Put(object, key, value);
+}
+
+inline uint32_t Put(DistributedObject &object, const std::string &key, const char *value)
+{
+    return FieldTraits<std::string_view>::Put(object, key, value);
+}
+
+template<typename T>
+uint32_t Get(DistributedObject &object, const std::string &key, T &value)
+{
+    return FieldTraits<T>::Get(object, key, value);
+}
+} // namespace OHOS::ObjectStore
+#endif // TYPED_OBJECT_H
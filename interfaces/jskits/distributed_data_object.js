@@ -34,6 +34,11 @@ const END_SIZE = 3;
 const MIN_SIZE = HEAD_SIZE + END_SIZE + 3;
 const REPLACE_CHAIN = '***';
 const DEFAULT_ANONYMOUS = '******';
+const SyncPolicy = {
+  AUTO: 0,
+  WINDOWED: 1,
+  MANUAL: 2
+};
 
 class Distributed {
   constructor(obj) {
@@ -491,6 +496,22 @@ class DistributedV9 {
     return this.__proxy.revokeSave(callback);
   }
 
+  setSyncPolicy(policy, window) {
+    if (this.__proxy[SESSION_ID] == null || this.__proxy[SESSION_ID] === '') {
+      console.info('not join a session, can not set sync policy');
+      return JS_ERROR;
+    }
+    return this.__proxy.setSyncPolicy(policy, window);
+  }
+
+  commit(callback) {
+    if (this.__proxy[SESSION_ID] == null || this.__proxy[SESSION_ID] === '') {
+      console.info('not join a session, can not do commit');
+      return JS_ERROR;
+    }
+    return this.__proxy.commit(callback);
+  }
+
   bindAssetStore(assetkey, bindInfo, callback) {
     if (this.__proxy[SESSION_ID] == null || this.__proxy[SESSION_ID] === '') {
       console.info('not join a session, can not do bindAssetStore');
@@ -573,5 +594,6 @@ class DistributedV9 {
 export default {
   createDistributedObject: newDistributed,
   create: newDistributedV9,
-  genSessionId: randomNum
+  genSessionId: randomNum,
+  SyncPolicy: SyncPolicy
 };